@@ -1,9 +1,15 @@
 /**
  * Author: Lucian Bicsi
  * License: CC0
- * Description: Quick flow algorithm. If it TLEs on ugly inputs,
- * adapt it to use capacity scaling.
- * Time: $O(V^2 E)$ or $O(E \sqrt{E})$ on unit graphs.
+ * Description: Quick flow algorithm. With \texttt{scaling}, augments
+ * along residual capacities $\geq 2^k, \dots, 1$; this bounds the time,
+ * but is usually slower. \texttt{SetCap} changes the capacity of edge
+ * \texttt{e} after a solve, repairs the flow and returns the change in
+ * flow value (undirected edge: call it for \texttt{e} and \texttt{e\^{}1}).
+ * Usage: Dinic D(n); int e = D.AddEdge(a, b, c); T f = D.Compute(s, t);
+ * f += D.SetCap(e, c - 1, s, t);
+ * Time: $O(V^2 E)$ or $O(E \sqrt{E})$ on unit graphs, $O(V E \log U)$ with
+ * scaling.
  * Status: Tested on kattis, SPOJ FASTFLOW, infoarena maxflow
  */
 #pragma once
@@ -15,6 +21,7 @@ struct Dinic {
    
   vector<Edge> es;
   vector<int> graph, at, dist, q;
+  T lim = 1;
   
   Dinic(int n) : graph(n, -1) {}
   
@@ -33,7 +40,7 @@ struct Dinic {
       int node = q[i];
       for (int ei = graph[node]; ei >= 0; ei = es[ei].nxt) {
         const auto &e = es[ei];
-        if (dist[e.to] == -1 && e.cap > e.flow) {
+        if (dist[e.to] == -1 && e.cap - e.flow >= lim) {
           dist[e.to] = dist[node] + 1;
           q.push_back(e.to);
         }
@@ -56,13 +63,40 @@ struct Dinic {
     }
     return ret;
   }
-  T Compute(int src, int dest) {
+  T Augment(int src, int dest, T most) {
     T ret = 0;
-    while (bfs(src, dest)) {
+    while (ret < most && bfs(src, dest)) {
       at = graph;
-      ret += dfs(src, dest, numeric_limits<T>::max());
+      ret += dfs(src, dest, most - ret);
     }
     return ret;
   }
+  T Compute(int src, int dest, bool scaling = false) {
+    T ret = 0, mx = 0;
+    if (scaling) for (auto& e : es) mx = max(mx, e.cap - e.flow);
+    for (lim = 1; lim <= mx / 2; lim *= 2);
+    for (; lim; lim /= 2)
+      ret += Augment(src, dest, numeric_limits<T>::max());
+    lim = 1;
+    return ret;
+  }
+  T SetCap(int ei, T c, int src, int dest) {
+    auto in = [&] { // flow into dest
+      T r = 0;
+      for (int ej = graph[dest]; ej >= 0; ej = es[ej].nxt) r -= es[ej].flow;
+      return r;
+    };
+    T old = in(), d = es[ei].flow - c;
+    int u = es[ei].from, v = es[ei].to;
+    es[ei].cap = c;
+    if (d > 0) { // u has excess d, v lacks d
+      es[ei].flow = c; es[ei ^ 1].flow = -c;
+      d -= Augment(u, v, d);
+      if (u != src && u != dest) Augment(u, src, d);
+      if (v != src && v != dest) Augment(dest, v, d);
+    }
+    Compute(src, dest);
+    return in() - old;
+  }
   bool SideOfCut(int x) { return dist[x] == -1; } 
 };
\ No newline at end of file
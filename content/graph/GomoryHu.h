@@ -1,29 +1,55 @@
 /**
- * Author: 
- * Source: Topcoder
- * Description: Computes Gomory-Hu tree of an undirected graph.
+ * Author: Lucian Bicsi
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: Gusfield - Very simple methods for all pairs network flow analysis
+ * Description: Computes the Gomory-Hu tree of an undirected graph, given
+ * as a \texttt{Dinic} or \texttt{PushRelabel} with undirected edges.
+ * Returns \texttt{par} (\texttt{par[0] = -1}) and \texttt{w}: the tree edge
+ * $(i, par_i)$ has weight $w_i$, and removing it splits the nodes into a
+ * minimum cut between its ends. The min cut between $u$ and $v$ is the
+ * lightest edge on their tree path. Uses $O(V)$ memory besides the flows.
+ * With \texttt{threads > 1}, the next flows are computed in parallel on
+ * copies of \texttt{D}, assuming the parents do not change; flows whose
+ * parent did change are redone. Flows are undone by copying back the
+ * edges with zero flow, which costs less than one BFS.
  * Time: O(V) calls of flow algorithm
- * Status: works
+ * Status: stress-tested
  */
 #pragma once
 
-tuple<T, int, int> GomoryHu(Dinic& D) {
-  int n = D.graph.size(); 
-  auto ret = make_tuple(numeric_limits<T>::max(), -1, -1);
-  vector<int> par(n, 0); par[0] = -1;
-  vector<vector<T>> ans(n, vector<T>(n, get<0>(ret)));
-
-  for (int i = 1; i < n; ++i) {
-    T now = D.Compute(i, par[i]);
-    for (int j = i + 1; j < n; ++j)
-      if (D.SideOfCut(j) == 0 && par[j] == par[i])
-        par[j] = i;
-    ans[i][par[i]] = ans[par[i]][i] = now;
-    for (int j = 0; j < i; ++j)
-      ans[i][j] = ans[j][i] = min(now, ans[par[i]][j]);
-    ret = min(ret, make_tuple(now, i, par[i]));
-    for (auto& e : D.es) e.flow = 0;
+template<class F>
+pair<vector<int>, vector<T>> GomoryHu(F& D, int threads = 1) {
+  int n = D.graph.size();
+  vector<int> par(n, 0); vector<T> w(n, 0); par[0] = -1;
+  threads = max(threads, 1);
+  auto es = D.es;
+  for (auto& e : es) e.flow = 0;
+  vector<F> Ds(threads, D);
+  vector<vector<char>> side(threads, vector<char>(n));
+  vector<int> to(threads); vector<T> f(threads);
+  auto cut = [&](int j, int s) {
+    F& E = Ds[j];
+    E.es = es; // O(E), less than one BFS
+    f[j] = E.Compute(s, to[j] = par[s]);
+    for (int x = 0; x < n; ++x) side[j][x] = !E.SideOfCut(x);
+  };
+  for (int s = 1; s < n;) {
+    int k = min(threads, n - s);
+    if (k == 1) cut(0, s);
+    else {
+      vector<thread> th;
+      for (int j = 0; j < k; ++j) th.emplace_back(cut, j, s + j);
+      for (auto& t : th) t.join();
+    }
+    for (int j = 0; j < k && par[s] == to[j]; ++j, ++s) {
+      int t = par[s]; auto& X = side[j];
+      for (int i = 0; i < n; ++i)
+        if (i != s && X[i] && par[i] == t) par[i] = s;
+      w[s] = f[j];
+      if (par[t] >= 0 && X[par[t]])
+        par[s] = par[t], par[t] = s, w[s] = w[t], w[t] = f[j];
+    }
   }
-  return ret;
+  return {par, w};
 }
-
@@ -65,7 +65,7 @@ struct MFMC {
         }
       }
       flow += now;
-      cost += pi[t];
+      cost += now * pi[t];
     }
     return {flow, cost};
   }
@@ -0,0 +1,105 @@
+/**
+ * Author: Lucian Bicsi
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: Cherkassky, Goldberg - On implementing push-relabel method for
+ * the maximum flow problem
+ * Description: Highest-label push-relabel, with the same edges and
+ * interface as "DinicFlow.h" (so either works with "GomoryHu.h").
+ * Uses global relabeling and the gap heuristic; excess that cannot reach
+ * the sink is returned to the source, so \texttt{es} is a valid flow.
+ * Time: $O(V^2\sqrt{E})$
+ * Status: stress-tested
+ */
+#pragma once
+
+using T = int;
+
+struct PushRelabel {
+  struct Edge { int from, to, nxt; T cap, flow; };
+
+  vector<Edge> es;
+  vector<int> graph, cur, h, cnt, q;
+  vector<T> ex; vector<vector<int>> B;
+  int n, hi, work, lim;
+
+  PushRelabel(int n) : graph(n, -1), n(n) {}
+
+  int AddEdge(int a, int b, T c, bool dir = true) {
+    auto add = [&](int a, int b, T c) {
+      es.push_back({a, b, graph[a], c, 0});
+      graph[a] = (int)es.size() - 1;
+    };
+    add(a, b, c); add(b, a, dir ? 0 : c);
+    return (int)es.size() - 2;
+  }
+  void push(int ei, int s, int t) {
+    Edge& e = es[ei]; T f = min(ex[e.from], e.cap - e.flow);
+    if (!ex[e.to] && e.to != s && e.to != t && h[e.to] < lim)
+      B[h[e.to]].push_back(e.to), hi = max(hi, h[e.to]);
+    e.flow += f; es[ei ^ 1].flow -= f;
+    ex[e.from] -= f; ex[e.to] += f;
+  }
+  /// Residual BFS from src (to src, if rev) over nodes with h = 2n
+  void bfs(int src, int base, bool rev = true) {
+    q.assign(1, src); h[src] = base;
+    for (int i = 0; i < (int)q.size(); ++i)
+      for (int ei = graph[q[i]]; ei >= 0; ei = es[ei].nxt) {
+        int v = es[ei].to; const Edge& r = es[ei ^ rev];
+        if (h[v] == 2 * n && r.cap > r.flow)
+          h[v] = h[q[i]] + 1, q.push_back(v);
+      }
+  }
+  /// h = distance to t in the residual graph, else n + distance to s
+  void globalRelabel(int s, int t) {
+    h.assign(n, 2 * n); cnt.assign(n, 0);
+    for (auto& b : B) b.clear();
+    h[s] = n; bfs(t, 0); h[s] = 2 * n; bfs(s, n);
+    hi = 0; work = 0; cur = graph;
+    for (int i = 0; i < n; ++i) {
+      if (h[i] < n) cnt[h[i]]++;
+      if (ex[i] > 0 && i != s && i != t && h[i] < lim)
+        B[h[i]].push_back(i), hi = max(hi, h[i]);
+    }
+  }
+  void relabel(int u) {
+    int old = h[u]; h[u] = 2 * n;
+    for (int ei = graph[u]; ei >= 0; ei = es[ei].nxt, ++work)
+      if (es[ei].cap > es[ei].flow) h[u] = min(h[u], h[es[ei].to] + 1);
+    cur[u] = graph[u];
+    if (old < n && !--cnt[old]) { // gap
+      for (int v = 0; v < n; ++v) if (old < h[v] && h[v] < n) {
+        --cnt[h[v]]; h[v] = n + 1;
+        if (ex[v] > 0 && h[v] < lim) B[h[v]].push_back(v), hi = max(hi, h[v]);
+      }
+      if (h[u] < n) h[u] = n + 1;
+    }
+    if (h[u] < n) cnt[h[u]]++;
+  }
+  T Compute(int s, int t) {
+    ex.assign(n, 0); B.assign(2 * n + 1, {});
+    for (int ei = graph[s]; ei >= 0; ei = es[ei].nxt) { // saturate
+      Edge& e = es[ei]; T f = e.cap - e.flow;
+        e.flow += f; es[ei ^ 1].flow -= f; ex[e.to] += f;
+    }
+    /// Phase 1 moves flow to t, phase 2 returns the rest to s
+    for (lim = n; lim <= 2 * n; lim += n) {
+      globalRelabel(s, t);
+      while (hi >= 0) {
+        if (B[hi].empty()) { --hi; continue; }
+        int u = B[hi].back(); B[hi].pop_back();
+        if (h[u] != hi) continue; // moved by a gap
+        while (ex[u] > 0 && h[u] < lim) {
+          if (cur[u] < 0) { relabel(u); continue; }
+          const Edge& e = es[cur[u]];
+          if (e.cap > e.flow && h[u] == h[e.to] + 1) push(cur[u], s, t);
+          else cur[u] = e.nxt;
+        }
+        if (work > 6 * n + (int)es.size()) globalRelabel(s, t);
+      }
+    }
+    h.assign(n, 2 * n); bfs(s, 0, 0); // h[x] < 2n iff s reaches x
+    return ex[t];
+  }
+  bool SideOfCut(int x) { return h[x] == 2 * n; }
+};
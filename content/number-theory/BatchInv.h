@@ -0,0 +1,23 @@
+/**
+ * Author: Lucian Bicsi
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: Montgomery - Speeding the Pollard and elliptic curve methods
+ * Description: Replaces every non-zero $a_i$ by its inverse, with one
+ * \texttt{inv()} and $3N$ multiplications: with prefix products
+ * $p_i = a_0 \cdots a_{i-1}$ and $t = p_{i+1}^{-1}$, $a_i^{-1} = t p_i$,
+ * and $p_i^{-1} = t a_i$. Works on any field type, e.g.\ \texttt{MInt<P>}.
+ * Time: O(N + \log MOD)
+ * Status: stress-tested
+ */
+#pragma once
+
+template<class T> void BatchInv(vector<T>& a) {
+  int n = a.size(); T z = 0;
+  vector<T> p(n + 1, 1);
+  for (int i = 0; i < n; ++i) p[i + 1] = a[i] == z ? p[i] : p[i] * a[i];
+  T t = p[n].inv();
+  for (int i = n - 1; i >= 0; --i) if (!(a[i] == z)) {
+    T x = a[i]; a[i] = t * p[i]; t = t * x;
+  }
+}
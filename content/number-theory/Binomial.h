@@ -0,0 +1,37 @@
+/**
+ * Author: Lucian Bicsi
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: folklore
+ * Description: Factorials, inverse factorials, inverses and binomials
+ * modulo a prime, from tables that grow on demand (doubling, up to {\tt MOD}),
+ * with a single \texttt{inv()} per growth. Needs $n <$ {\tt MOD}.
+ * \texttt{Grow(n)} can be called up front to avoid resizing later.
+ * Usage: Binomial<> B; B.C(10, 3); // 120
+ * Time: O(1) per query, amortized
+ * Status: stress-tested
+ */
+#pragma once
+
+#include "ModInt.h"
+
+template<class T = ModInt> struct Binomial {
+  vector<T> f{1}, fi{1};
+  void Grow(int n) { // tables cover [0, n]
+    int m = f.size();
+    if (n < m) return;
+    n = max(n, (int)min<ll>(2 * m, T::mod() - 1));
+    f.resize(n + 1); fi.resize(n + 1);
+    T x = m - 1;
+    for (int i = m; i <= n; ++i) f[i] = f[i - 1] * (x = x + 1);
+    fi[n] = f[n].inv();
+    for (int i = n; i > m; --i) fi[i - 1] = fi[i] * x, x = x - 1;
+  }
+  T Fact(int n) { Grow(n); return f[n]; }
+  T InvFact(int n) { Grow(n); return fi[n]; }
+  T Inv(int n) { Grow(n); return fi[n] * f[n - 1]; } // n > 0
+  T C(int n, int k) {
+    if (k < 0 || k > n) return 0;
+    Grow(n); return f[n] * fi[k] * fi[n - k];
+  }
+};
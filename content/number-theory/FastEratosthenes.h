@@ -0,0 +1,86 @@
+/**
+ * Author: Lucian Bicsi
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: https://github.com/kimwalisch/primesieve (the mod 30 wheel)
+ * Description: Calls \texttt{f(p, t)} for all primes $p \le n$. Only
+ * numbers coprime to 30 are stored, one byte per 30 numbers, and
+ * the range is sieved in segments of \texttt{S} bytes that fit in L2.
+ * A sieving prime $p$ hits each of the 8 residues every $p$ bytes,
+ * so it keeps 8 offsets; 7 to 17 are copied from a precomputed
+ * pattern. With \texttt{threads} $> 1$ the range is split into
+ * contiguous parts, and $f$ is called concurrently, in increasing
+ * order within each part; $t$ is the index of the part. Memory is
+ * $O(\sqrt n)$: primes are never stored.
+ * Usage: ll s = 0; PrimeSieve(1e9, [&](ull p, int) { s += p; });
+ * Time: O(n \log \log n) (around 0.4s for $n = 10^9$, 5s for $10^{10}$)
+ * Status: stress-tested
+ */
+#pragma once
+
+typedef unsigned long long ull;
+
+template<class F> void PrimeSieve(ull n, F f, int threads = 1) {
+  const int S = 1 << 17, R[8] = {1, 7, 11, 13, 17, 19, 23, 29};
+  for (ull p : {2, 3, 5}) if (p <= n) f(p, 0);
+  if (n < 7) return;
+  ull r = (ull)sqrtl(n), N = n / 30 + 1; // bytes
+  while (r * r > n) --r;
+  while ((r + 1) * (r + 1) <= n) ++r;
+  vector<int> ps; vector<bool> c(r + 1);
+  for (ull i = 2; i <= r; ++i) if (!c[i]) {
+    if (i > 5) ps.push_back((int)i);
+    for (ull j = i * i; j <= r; j += i) c[j] = 1;
+  }
+  int bit[30] = {}, inv[30] = {};
+  for (int k = 0; k < 8; ++k) {
+    bit[R[k]] = k;
+    for (int j = 0; j < 8; ++j) if (R[k] * R[j] % 30 == 1) inv[R[k]] = R[j];
+  }
+  const ull W = 7 * 11 * 13 * 17; // crossed out in a repeating pattern
+  vector<uint8_t> pat(W, 0xff);
+  for (ull j = 0; j < W; ++j) for (int k = 0; k < 8; ++k)
+    for (int p : {7, 11, 13, 17})
+      if ((30 * j + R[k]) % p == 0) pat[j] &= uint8_t(~(1 << k));
+  ull per = (N / threads + S) / S * S;
+  auto run = [&](int t) {
+    ull lo = t * per, hi = min(N, lo + per);
+    if (lo >= hi) return;
+    /// nx[8i + k]: next byte where p_i q has residue R[k]
+    vector<ull> nx(8 * ps.size()); vector<uint8_t> seg(S);
+    for (int i = 0; i < (int)ps.size(); ++i) {
+      ull p = ps[i], q0 = max(p, (30 * lo + p - 1) / p);
+      for (int k = 0; k < 8; ++k) {
+        ull c = R[k] * inv[p % 30] % 30, q = q0 + (c + 30 - q0 % 30) % 30;
+        nx[8 * i + bit[p * q % 30]] = p * q / 30;
+      }
+    }
+    for (ull L = lo; L < hi; L += S) {
+      ull len = min<ull>(S, hi - L);
+      for (ull i = 0, o = L % W; i < len; o = 0) { // pattern of 7..17
+        ull c = min(len - i, W - o);
+        memcpy(&seg[i], &pat[o], c); i += c;
+      }
+      for (int i = 4; i < (int)ps.size(); ++i)
+        for (int k = 0; k < 8; ++k) { // locals, as uint8_t aliases all
+          ull j = nx[8 * i + k] - L, p = ps[i];
+          uint8_t m = uint8_t(~(1 << k)), *s = &seg[0];
+          for (; j < len; j += p) s[j] &= m;
+          nx[8 * i + k] = j + L;
+        }
+      if (L == 0) seg[0] = 0x1e | (seg[0] & 0xe0); // 1 no, 7..17 yes
+      for (ull i = 0; i < len; i += 8) {
+        ull w = 0; memcpy(&w, &seg[i], min<ull>(8, len - i));
+        for (; w; w &= w - 1) {
+          int b = __builtin_ctzll(w);
+          ull p = 30 * (L + i + b / 8) + R[b % 8];
+          if (p <= n) f(p, t);
+        }
+      }
+    }
+  };
+  if (threads <= 1) { run(0); return; }
+  vector<thread> th;
+  for (int t = 0; t < threads; ++t) th.emplace_back(run, t);
+  for (auto& x : th) x.join();
+}
@@ -0,0 +1,30 @@
+/**
+ * Author: Lucian Bicsi
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: https://cp-algorithms.com/algebra/prime-sieve-linear.html
+ * Description: Smallest prime factor \texttt{lp}, Euler's $\phi$ and
+ * M\"obius $\mu$ of all $i \le n$, plus the primes. Each composite is
+ * crossed out once, by its smallest prime factor. Memory is 9 bytes per
+ * number (900MB for $n = 10^8$); drop \texttt{phi} or \texttt{mu} if not needed.
+ * Usage: LinearSieve s(1e7); s.lp[12] == 2; s.phi[12] == 4; s.mu[12] == 0;
+ * Time: O(n) (around 0.15s for $n = 10^7$)
+ * Status: stress-tested
+ */
+#pragma once
+
+struct LinearSieve {
+  vector<int> pr, lp, phi; vector<signed char> mu;
+  LinearSieve(int n) : lp(n + 1), phi(n + 1), mu(n + 1) {
+    if (n >= 1) phi[1] = mu[1] = 1;
+    for (int i = 2; i <= n; ++i) {
+      if (!lp[i]) lp[i] = i, phi[i] = i - 1, mu[i] = -1, pr.push_back(i);
+      for (int p : pr) {
+        if (p > lp[i] || (ll)i * p > n) break;
+        int j = i * p; lp[j] = p;
+        if (p == lp[i]) phi[j] = phi[i] * p, mu[j] = 0;
+        else phi[j] = phi[i] * (p - 1), mu[j] = -mu[i];
+      }
+    }
+  }
+};
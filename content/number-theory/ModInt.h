@@ -2,26 +2,69 @@
  * Author: Lucian Bicsi
  * Date: 2021-01-01
  * License: CC0
- * Source: folklore
- * Description: Operators for modular arithmetic. You need 
- * to set {\tt MOD} to some number first and then you can use 
- * the structure.
+ * Source: https://cp-algorithms.com/algebra/montgomery_multiplication.html
+ * Description: Operators for modular arithmetic, modulo an odd
+ * $M < 2^{31}$ (\texttt{MInt<M>}) or $M < 2^{63}$ (\texttt{MInt64<M>}).
+ * Values are kept in Montgomery form $x 2^{32} \bmod M$ ($x 2^{64}$), so no
+ * division is done outside of the constructor; constants are computed at
+ * compile time. The field \texttt{x} is that form, not the residue: read
+ * values with \texttt{Get()}. Even moduli are not supported.
+ * \texttt{DynMInt} takes the modulus at runtime.
+ * {\tt ModInt} works modulo {\tt MOD}; you need to set it first.
+ * Usage: MInt<998244353> a = 5; auto b = a.inv() * 3; b.Get();
+ * DynMInt::Set(1e9 + 7); DynMInt c = 2;
+ * Status: stress-tested
  */
 #pragma once
 
-const int MOD = 17; // change to something else
-struct ModInt {
-  int x;
-  ModInt(int x = 0) : x(x + (x < 0) * MOD - (x >= MOD) * MOD){}
-  ModInt operator+(ModInt o) { return x + o.x; }
-  ModInt operator-(ModInt o) { return x - o.x; }
-  ModInt operator*(ModInt o) { return 1LL * x * o.x % MOD; }
-  ModInt operator/(ModInt b) { return *this * b.inv(); }
-  ModInt inv() { return pow(MOD - 2); }
-  ModInt pow(long long e) {
-    if (!e) return 1;
-    ModInt r = pow(e / 2); r = r * r;
-    return e % 2 ? *this * r : r;
+template<class U, class U2, U M> struct Mont {
+  static constexpr int B = 8 * sizeof(U);
+  static constexpr U Inv(U m) { // m^{-1} mod 2^B
+    U r = 1;
+    for (int i = 1; i < B; i *= 2) r *= 2 - m * r;
+    return r;
+  }
+  static constexpr U Sq(U m) { // 2^{2B} mod m
+    U r = U(((U2)1 << B) % m);
+    return U((U2)r * r % m);
+  }
+  static_assert(!M || M % 2, "M must be odd");
+  static constexpr U IV = M ? Inv(M) : 0, R2 = M ? Sq(M) : 0;
+  static inline U md, iv, r2; // only for M = 0
+  static void Set(U m) { assert(m % 2); md = m; iv = Inv(m); r2 = Sq(m); }
+  static U mod() { return M ? M : md; }
+  static U reduce(U2 x) {
+    U q = U(x) * (M ? IV : iv), a = U((x - (U2)q * mod()) >> B);
+    return a >= mod() ? a + mod() : a; // not a mistake
+  }
+
+  U x;
+  Mont(long long v = 0) {
+    v %= (long long)mod(); if (v < 0) v += mod();
+    x = reduce((U2)v * (M ? R2 : r2));
   }
-  bool operator==(ModInt o) { return x == o.x; }
-};
\ No newline at end of file
+  Mont operator+(Mont o) const {
+    o.x += x; if (o.x >= mod()) o.x -= mod();
+    return o;
+  }
+  Mont operator-(Mont o) const {
+    o.x = x - o.x; if (o.x >= mod()) o.x += mod();
+    return o;
+  }
+  Mont operator*(Mont o) const { o.x = reduce((U2)x * o.x); return o; }
+  Mont operator/(Mont o) const { return *this * o.inv(); }
+  Mont inv() const { return pow(mod() - 2); }
+  Mont pow(unsigned long long e) const {
+    Mont r = 1, b = *this;
+    for (; e; e /= 2, b = b * b) if (e & 1) r = r * b;
+    return r;
+  }
+  U Get() const { return reduce(x); }
+  bool operator==(Mont o) const { return x == o.x; }
+};
+template<uint32_t M> using MInt = Mont<uint32_t, uint64_t, M>;
+template<uint64_t M> using MInt64 = Mont<uint64_t, __uint128_t, M>;
+using DynMInt = MInt<0>; // call DynMInt::Set(m) first
+
+const int MOD = 17; // change to something else
+using ModInt = MInt<MOD>;
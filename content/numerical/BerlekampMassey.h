@@ -16,9 +16,9 @@
 
 #include "../number-theory/ModInt.h"
 
-vector<ModInt> BerlekampMassey(vector<ModInt> s) {
+template<class F = ModInt> vector<F> BerlekampMassey(vector<F> s) {
   int n = s.size();
-  vector<ModInt> C(n, 0), B(n, 0);
+  vector<F> C(n, 0), B(n, 0);
   C[0] = B[0] = 1;
 
   auto b = C[0]; int L = 0;
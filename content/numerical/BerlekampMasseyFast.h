@@ -0,0 +1,122 @@
+/**
+ * Author: Lucian Bicsi
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: Thull, Yap - A unified approach to HGCD algorithms
+ * Description: Same as "BerlekampMassey.h", in $O(N \log^2 N)$.
+ * With $S = \sum s_i X^{n-1-i}$, the reversed connection polynomial
+ * is the first cofactor $v$ in the euclidean algorithm on $(X^n, S)$
+ * with $\deg (v S \bmod X^n) < \deg v$. Half-GCD jumps to the
+ * remainders around degree $n/2$, after which at most one step is left.
+ * If $2L > n$ the recurrence is not unique, and may differ
+ * from the one given by "BerlekampMassey.h" (both have minimal length).
+ * Needs NTT-friendly {\tt MOD}. Crossover is at $n = 1500$.
+ * Time: $O(N \log^2 N)$ (around 3.5s for $N=2 \cdot 10^5$)
+ * Status: stress-tested
+ */
+#pragma once
+
+#include "BerlekampMassey.h"
+#include "PolyDivRem.h"
+
+struct HalfGCD {
+  using P = vector<ModInt>; using M = array<P, 4>;
+  static P trim(P a) {
+    while (a.size() && a.back() == 0) a.pop_back();
+    return a;
+  }
+  static P mul(P a, P b) {
+    if (min(a.size(), b.size()) > 32) return trim(Mul(a, b));
+    if (a.empty() || b.empty()) return {};
+    P c(a.size() + b.size() - 1, 0);
+    for (int i = 0; i < (int)a.size(); ++i)
+      for (int j = 0; j < (int)b.size(); ++j)
+        c[i + j] = c[i + j] + a[i] * b[j];
+    return trim(c);
+  }
+  static P add(P a, P b, ModInt c = 1) { // a + c b
+    a.resize(max(a.size(), b.size()), 0);
+    for (int i = 0; i < (int)b.size(); ++i) a[i] = a[i] + c * b[i];
+    return trim(a);
+  }
+  static P shr(P a, int k) { // a div X^k
+    return P(a.begin() + min(k, (int)a.size()), a.end());
+  }
+  static M mul(M a, M b) { // shares the transforms of the entries
+    int s = 0, n = 1; M c;
+    for (int i = 0; i < 4; ++i)
+      s = max(s, (int)(a[i & 2].size() + b[i & 1].size()));
+    for (int i = 0; i < 4; ++i)
+      s = max(s, (int)(a[(i & 2) + 1].size() + b[(i & 1) + 2].size()));
+    if (s <= 64) {
+      for (int i = 0; i < 4; ++i)
+        c[i] = add(mul(a[i & 2], b[i & 1]),
+            mul(a[(i & 2) + 1], b[(i & 1) + 2]));
+      return c;
+    }
+    while (n < s) n *= 2;
+    for (auto* x : {&a, &b})
+      for (auto& p : *x) if (p.size()) p.resize(n, 0), DFT(p, 0);
+    for (int i = 0; i < 4; ++i) {
+      c[i].assign(n, 0);
+      for (int j = 0; j < 2; ++j) {
+        auto &x = a[(i & 2) + j], &y = b[(i & 1) + 2 * j];
+        if (x.size() && y.size())
+          for (int k = 0; k < n; ++k) c[i][k] = c[i][k] + x[k] * y[k];
+      }
+      DFT(c[i], 1); c[i] = trim(c[i]);
+    }
+    return c;
+  }
+  static void apply(M m, P& a, P& b) { // (a, b) = m (a, b)
+    M r = mul(m, M{a, P{}, b, P{}}); a = r[0]; b = r[2];
+  }
+  static void step(M& m, P& a, P& b) { // (a, b) = (b, a mod b)
+    int d = (int)a.size() - (int)b.size() + 1;
+    P q(d, 0);
+    if (min(d, (int)b.size()) > 32) q = Div(a, b);
+    else {
+      P r = a; auto ib = b.back().inv();
+      for (int i = d - 1; i >= 0; --i) {
+        q[i] = r[i + b.size() - 1] * ib;
+        for (int j = 0; j < (int)b.size(); ++j)
+          r[i + j] = r[i + j] - q[i] * b[j];
+      }
+    }
+    P r = add(a, mul(q, b), -1); a = b; b = r;
+    m = {m[2], m[3], add(m[0], mul(q, m[2]), -1),
+        add(m[1], mul(q, m[3]), -1)};
+  }
+  /// Returns m s.t. (a', b') = m (a, b) are consecutive remainders
+  /// with deg a' >= ceil(deg a / 2) > deg b'. Needs deg a > deg b.
+  static M hgcd(P a, P b) {
+    int n = (int)a.size() - 1, k = (n + 1) / 2;
+    M m{P{1}, P{}, P{}, P{1}};
+    if ((int)b.size() - 1 < k) return m;
+    if (n <= 64) {
+      while ((int)b.size() - 1 >= k) step(m, a, b);
+      return m;
+    }
+    m = hgcd(shr(a, k), shr(b, k)); apply(m, a, b);
+    if ((int)b.size() - 1 < k) return m;
+    step(m, a, b);
+    int l = 2 * k - ((int)a.size() - 1);
+    if ((int)b.size() - 1 < k) return m;
+    return mul(hgcd(shr(a, l), shr(b, l)), m);
+  }
+};
+
+vector<ModInt> BerlekampMasseyFast(vector<ModInt> s) {
+  int n = (int)s.size();
+  if (n <= 1500) return BerlekampMassey(s);
+  using H = HalfGCD;
+  H::P a(n + 1, 0), b(s.rbegin(), s.rend()); a[n] = 1;
+  b = H::trim(b);
+  H::M m = H::hgcd(a, b); H::apply(m, a, b);
+  if ((int)b.size() >= (int)m[3].size()) H::step(m, a, b);
+  auto v = m[3]; int L = (int)v.size() - 1;
+  auto il = v.back().inv();
+  vector<ModInt> ret(L);
+  for (int i = 1; i <= L; ++i) ret[i - 1] = ModInt(0) - v[L - i] * il;
+  return ret;
+}
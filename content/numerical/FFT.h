@@ -4,22 +4,91 @@
  * License: CC0
  * Source: based on https://github.com/kmyk/competitive-programming-library
  * Description: Cooley-Tukey-like fft. For better precision, see "NTT.h".
- * Time: $O(N \log N)$
+ * Roots are computed once in long double and cached; transforms run
+ * in place. \texttt{Conv} convolves two real sequences with only 2
+ * transforms, by packing them into one complex sequence.
+ * Rounding is safe if $(\sum a_i^2 + \sum b_i^2)\log_2{N} < 9\cdot10^{14}$
+ * (in practice $10^{16}$). \texttt{ConvMod} works modulo any
+ * $M \le 2^{30}$, by splitting inputs into 15-bit halves (4 transforms).
+ * It is exact if $N \log_2 N \cdot M < 8.6 \cdot 10^{14}$ (in practice
+ * $N \cdot M < 10^{15}$, e.g. $N = 2^{20}$ for $M \approx 10^9$).
+ * Time: $O(N \log N)$ (around 0.4s for \texttt{ConvMod} with $N=2^{20}$)
  * Status: stress-tested
  */
 #pragma once
 
-void DFT(vector<complex<double>> &a, bool rev) {
-  int n = a.size(); auto b = a; 
-  for (int step = n / 2; step; step /= 2) {
-    for (int i = 0; i < n / 2; i += step) {
-      auto wn = polar(1.0, 2.0 * M_PI * (rev ? -i : i) / n);
-      for (int j = 0; j < step; ++j) {
-        auto u = a[i * 2 + j], v = wn * a[i * 2 + j + step];
-        b[i + j] = u + v; b[i + n / 2 + j] = u - v;
-      }
+using C = complex<double>;
+struct FFT {
+  vector<C> rt{1, 1}; vector<complex<long double>> R{1, 1};
+  void Reserve(int n) { // rt[k + j] = exp(i pi j / k)
+    for (int k = rt.size(); k < n; k *= 2) {
+      rt.resize(2 * k); R.resize(2 * k);
+      auto x = polar(1.0L, acosl(-1) / k);
+      for (int i = k; i < 2 * k; ++i)
+        R[i] = i % 2 ? R[i / 2] * x : R[i / 2], rt[i] = C(R[i]);
     }
-    swap(a, b);
   }
-  if (rev) for (auto& x : a) x /= n;
+  void Run(C* a, int n, bool rev) {
+    Reserve(n);
+    for (int i = 1, j = 0; i < n; ++i) {
+      for (int b = n / 2; (j ^= b) < b; b /= 2);
+      if (i < j) swap(a[i], a[j]);
+    }
+    for (int k = 1; k < n; k *= 2)
+      for (int i = 0; i < n; i += 2 * k)
+        for (int j = i; j < i + k; ++j) {
+          C w = rt[j - i + k], x = a[j + k], z(
+            w.real() * x.real() - w.imag() * x.imag(),
+            w.real() * x.imag() + w.imag() * x.real());
+          a[j + k] = a[j] - z; a[j] += z;
+        }
+    if (rev && n) {
+      reverse(a + 1, a + n);
+      for (int i = 0; i < n; ++i) a[i] /= n;
+    }
+  }
+};
+
+void DFT(vector<C> &a, bool rev) {
+  static FFT fft; fft.Run(a.data(), a.size(), rev);
+}
+
+vector<double> Conv(const vector<double>& a, const vector<double>& b) {
+  if (a.empty() || b.empty()) return {};
+  vector<double> res(a.size() + b.size() - 1);
+  int n = 1; while (n < (int)res.size()) n *= 2;
+  vector<C> in(n), out(n);
+  for (int i = 0; i < (int)a.size(); ++i) in[i].real(a[i]);
+  for (int i = 0; i < (int)b.size(); ++i) in[i].imag(b[i]);
+  DFT(in, 0);
+  for (auto& x : in) x *= x;
+  for (int i = 0; i < n; ++i) out[i] = in[-i & (n - 1)] - conj(in[i]);
+  DFT(out, 0);
+  for (int i = 0; i < (int)res.size(); ++i)
+    res[i] = imag(out[i]) / (4 * n);
+  return res;
+}
+
+vector<ll> ConvMod(const vector<ll>& a, const vector<ll>& b, ll M) {
+  if (a.empty() || b.empty()) return {};
+  vector<ll> res(a.size() + b.size() - 1);
+  int n = 1, cut = 1 << 15; while (n < (int)res.size()) n *= 2;
+  vector<C> L(n), R(n), outl(n), outs(n);
+  for (int i = 0; i < (int)a.size(); ++i)
+    L[i] = C((int)a[i] / cut, (int)a[i] % cut);
+  for (int i = 0; i < (int)b.size(); ++i)
+    R[i] = C((int)b[i] / cut, (int)b[i] % cut);
+  DFT(L, 0); DFT(R, 0);
+  for (int i = 0; i < n; ++i) {
+    int j = -i & (n - 1);
+    outl[j] = (L[i] + conj(L[j])) * R[i] / (2.0 * n);
+    outs[j] = (L[i] - conj(L[j])) * R[i] / (2.0 * n) / C(0, 1);
+  }
+  DFT(outl, 0); DFT(outs, 0);
+  for (int i = 0; i < (int)res.size(); ++i) {
+    ll av = llround(real(outl[i])), cv = llround(imag(outs[i]));
+    ll bv = llround(imag(outl[i])) + llround(real(outs[i]));
+    res[i] = ((av % M * cut + bv) % M * cut + cv) % M;
+  }
+  return res;
 }
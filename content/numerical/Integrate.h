@@ -6,6 +6,8 @@
  * Description: Simple integration of a function over an interval using
  *  Simpson's rule. According to cp-algorithms, the error is
  * $-\frac{1}{90} (\frac{b-a}{2})^5 f^{(4)}(\xi)$ for some $\xi \in [a, b]$.
+ * \texttt{QuadBatch} is the same with a single call \texttt{f(x, y, k)}
+ * setting $y_i = f(x_i)$ for $i < k$, for vectorized integrands.
  * Status: mostly untested
  */
 #pragma once
@@ -19,3 +21,14 @@ double Quad(Func f, double a, double b) {
     v += f(a + i * h) * (i & 1 ? 4 : 2);
   return v * h / 3;
 }
+
+template<typename Func>
+double QuadBatch(Func f, double a, double b) {
+  const int n = 1000;
+  double h = (b - a) / 2 / n, x[2 * n + 1], y[2 * n + 1];
+  for (int i = 0; i <= 2 * n; ++i) x[i] = a + i * h;
+  f(x, y, 2 * n + 1);
+  double v = y[0] + y[2 * n];
+  for (int i = 1; i < 2 * n; ++i) v += y[i] * (i & 1 ? 4 : 2);
+  return v * h / 3;
+}
@@ -14,12 +14,15 @@
 #pragma once
 
 template<typename Func>
-double recurse(Func f, double a, double b,
+double simpson(Func& f, double a, double b) {
+  return (f(a) + 4 * f((a + b) / 2) + f(b)) * (b - a) / 6;
+}
+
+template<typename Func>
+double recurse(Func& f, double a, double b,
                double eps, double S) {
-  auto simpson = [&](double a, double b) {
-    return (f(a) + 4 * f((a + b) / 2) + f(b)) * (b - a) / 6; };
   double c = (a + b) / 2;
-  double S1 = simpson(a, c), S2 = simpson(c, b);
+  double S1 = simpson(f, a, c), S2 = simpson(f, c, b);
   double T = S1 + S2;
   if (abs(T - S) < 15 * eps || b - a < 1e-10)
     return T + (T - S) / 15;
@@ -0,0 +1,74 @@
+/**
+ * Author: Lucian Bicsi
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: QUADPACK (QAG with the 15-point Kronrod rule)
+ * Description: Adaptive Gauss-Kronrod integration without recursion.
+ * Intervals are kept in a priority queue by error estimate $|K_{15} - G_7|$.
+ * Each round, the worst intervals (enough to get below \texttt{eps}, at most
+ * $16 \cdot$ \texttt{threads}) are halved, and all new abscissae are evaluated in
+ * one call \texttt{f(x, y, k)} setting $y_i = f(x_i)$, $i < k$. With
+ * \texttt{threads > 1}, that call is split between threads (so $f$ must be
+ * thread-safe). Stops after \texttt{lim} intervals.
+ * Usage: QuadGK([&](const double* x, double* y, int k) {
+ *   for (int i = 0; i < k; ++i) y[i] = sin(x[i]); }, 0, 1);
+ * Time: O(\#intervals \log), 15 evaluations per interval
+ * Status: stress-tested
+ */
+#pragma once
+
+template<class F>
+double QuadGK(F f, double a, double b, double eps = 1e-10,
+    int threads = 1, int lim = 1 << 16) {
+  static const double X[8] = {.991455371120812639, .949107912342758525,
+    .864864423359769073, .741531185599394440, .586087235467691130,
+    .405845151377397167, .207784955007898468, 0},
+  WK[8] = {.022935322010529225, .063092092629978553, .104790010322250184,
+    .140653259715525919, .169004726639267903, .190350578064785410,
+    .204432940075298892, .209482141084727828},
+  WG[4] = {.129484966168869693, .279705391489276668, .381830050505118945,
+    .417959183673469388};
+  struct I {
+    double a, b, v, e;
+    bool operator<(const I& o) const { return e < o.e; }
+  };
+  priority_queue<I> q; double err = 0;
+  vector<I> cur{{a, b, 0, 0}}; vector<double> x, y;
+  while (true) {
+    int k = 15 * (int)cur.size();
+    x.resize(k); y.resize(k);
+    for (int i = 0; i < k; ++i) {
+      I& s = cur[i / 15]; int j = i % 15;
+      double c = (s.a + s.b) / 2, h = (s.b - s.a) / 2;
+      x[i] = c + (j < 8 ? X[j] : -X[j - 8]) * h;
+    }
+    if (threads <= 1) f(x.data(), y.data(), k);
+    else {
+      vector<thread> th; int c = (k + threads - 1) / threads;
+      for (int l = 0; l < k; l += c)
+        th.emplace_back([&, l] { f(&x[l], &y[l], min(c, k - l)); });
+      for (auto& t : th) t.join();
+    }
+    for (int i = 0; i < k; i += 15) {
+      I& s = cur[i / 15]; double K = 0, G = 0, h = (s.b - s.a) / 2;
+      for (int j = 0; j < 15; ++j) {
+        int t = j < 8 ? j : j - 8;
+        K += WK[t] * y[i + j];
+        if (t % 2) G += WG[t / 2] * y[i + j];
+      }
+      s.v = K * h; s.e = abs(K - G) * h;
+      q.push(s); err += s.e;
+    }
+    if (err <= eps || (int)q.size() >= lim) break;
+    cur.clear();
+    for (; q.size() && err > eps && (int)cur.size() < 16 * max(threads, 1);
+        q.pop()) {
+      I s = q.top(); double m = (s.a + s.b) / 2;
+      err -= s.e;
+      cur.push_back({s.a, m, 0, 0}); cur.push_back({m, s.b, 0, 0});
+    }
+  }
+  double v = 0;
+  for (; q.size(); q.pop()) v += q.top().v;
+  return v;
+}
@@ -1,42 +1,61 @@
 /**
  * Author: Lucian Bicsi
- * Source: Chinese material
+ * Source: https://arxiv.org/abs/2008.08822 (Bostan, Mori)
  * Description: Generates the k-th term of a n-th order
  * linear recurrence given the first n terms and the
  * recurrence relation. Faster than matrix multiplication.
  * Useful to use along with Berlekamp Massey.
  * Recurrence is $s_i = \sum_{j=0}^{n-1} s_{i-j-1} * trans_{j}$
  * where $first = \{s_0, s_1, ..., s_{n - 1}\}$
+ * Computes $[x^k] P(x) / Q(x)$ by replacing it with
+ * $[x^{k/2}]$ of the even/odd part of $P(x)Q(-x) / Q(x^2)$. The chain of
+ * $Q$s does not depend on $k$, so \texttt{LinRec} caches their
+ * transforms, and each query costs 2 transforms of size $2n$ per bit of $k$.
  * Usage: LinearRec({0, 1}, {1, 1}, k) gives k-th
- * Fibonacci number (0-indexed)
- * Time: O(N^{2} log(K)) per query
+ * Fibonacci number (0-indexed). LinRec<ModInt> L(first, trans); L.Get(k);
+ * Time: O(N \log N \log K) per query, memory O(N \log K)
+ * Status: stress-tested
  */
-#pragma once 
+#pragma once
 
-using Poly = vector<ModInt>;
+#include "NTT.h"
 
-ModInt LinearRec(Poly first, Poly trans, int k) {
-  int n = trans.size(); // assert(n <= (int)first.size());
-  Poly r(n + 1, 0), b(r); r[0] = b[1] = 1;
-  auto ans = b[0];
-
-  auto combine = [&](Poly a, Poly b) { // a * b mod trans
-    Poly res(n * 2 + 1, 0);
-    for (int i = 0; i <= n; ++i)
-      for (int j = 0; j <= n; ++j)
-        res[i + j] = res[i + j] + a[i] * b[j];
-    for (int i = 2 * n; i > n; --i)
-      for (int j = 0; j < n; ++j)
-        res[i - 1 - j] = res[i - 1 - j] + res[i] * trans[j];
-    res.resize(n + 1);
-    return res;
-  };
-  // Consider caching the powers for multiple queries
-  for (++k; k; k /= 2) {
-    if (k % 2) r = combine(r, b);
-    b = combine(b, b);
+template<class T> struct LinRec {
+  using Poly = vector<T>;
+  int n, N = 1; Poly p, q; vector<Poly> qm;
+  LinRec(Poly first, Poly trans) : n(trans.size()), q(n + 1, 0) {
+    while (N < 2 * n + 1) N *= 2;
+    q[0] = 1;
+    for (int i = 0; i < n; ++i) q[i + 1] = T(0) - trans[i];
+    p.assign(2 * n, 0);  // p = first * q mod x^n
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; i + j < n; ++j)
+        p[i + j] = p[i + j] + first[i] * q[j];
+    p.resize(n);
+  }
+  void extend() { // qm[i] = DFT of Q_i(-x), Q_{i+1}(x^2) = Q_i(x) Q_i(-x)
+    Poly f = q, m(N); f.resize(N, 0); DFT(f, 0);
+    for (int i = 0; i < N; ++i) m[i] = f[(i + N / 2) % N];
+    for (int i = 0; i < N; ++i) f[i] = f[i] * m[i];
+    DFT(f, 1); qm.push_back(m);
+    for (int i = 0; i <= n; ++i) q[i] = f[2 * i];
   }
-  for (int i = 0; i < n; ++i)
-    ans = ans + r[i + 1] * first[i];
-  return ans;
+  T Get(long long k) {
+    if (!n) return 0;
+    Poly a = p;
+    for (int i = 0; k; ++i, k /= 2) {
+      if (i == (int)qm.size()) extend();
+      a.resize(N, 0); DFT(a, 0);
+      for (int j = 0; j < N; ++j) a[j] = a[j] * qm[i][j];
+      DFT(a, 1);
+      for (int j = 0; j < n; ++j) a[j] = a[2 * j + k % 2];
+      a.resize(n);
+    }
+    return a[0];
+  }
+};
+
+template<class T = ModInt>
+T LinearRec(vector<T> first, vector<T> trans, long long k) {
+  return LinRec<T>(first, trans).Get(k);
 }
@@ -3,10 +3,19 @@
  * Date: 2020-11-28
  * License: CC0
  * Source: based on https://github.com/kmyk/competitive-programming-library
- * Description: Cooley-Tukey-like ntt. 
- * Discrete Fourier modulo specific nice primes of the form 
- * $2^a b+1$, where the convolution result has size at 
- * most $2^a$. 
+ * Description: Cooley-Tukey-like ntt.
+ * Discrete Fourier modulo specific nice primes of the form
+ * $2^a b+1$, where the convolution result has size at
+ * most $2^a$. Roots are computed once and grown on demand;
+ * transforms run in place and do not allocate.
+ * Works on any \texttt{MInt<P>} (see "ModInt.h"), with roots kept
+ * per type, so several primes can be used in one program. For
+ * \texttt{DynMInt}, they are rebuilt when the modulus changes.
+ * For \texttt{MInt<P>} with $P < 2^{30}$, butterflies work on the raw
+ * Montgomery values and only reduce them to $[0, 2P)$.
+ * Saving the per-call setup helps for many small transforms; from
+ * about $2^{14}$ on, it is no faster than a Stockham transform with
+ * per-call roots (the bit reversal costs what the lazy butterflies save).
  * Takes around 100ms on $N = 5 \cdot 10^5$ on library-checker.
  * Time: $O(N \log N)$
  * Status: stress-tested
@@ -16,24 +25,56 @@
 #include "../number-theory/ModInt.h"
 
 // Good MOD: (119 << 23 + 1), (5 << 25 + 1), (5LL << 55 + 1)
-void DFT(vector<ModInt> &a, bool rev) {
-  int n = a.size(); auto b = a; // assert(!(n & (n - 1)));
-  ModInt g = 1; while (g.pow((MOD - 1) / 2) == 1) g = g + 1;
-  if (rev) g = g.inv();
-  
-  for (int step = n / 2; step; step /= 2) {
-    ModInt w = g.pow((MOD - 1) / (n / step)), wn = 1; 
-    for (int i = 0; i < n / 2; i += step) {
-      for (int j = 0; j < step; ++j) {
-        auto u = a[2 * i + j], v = wn * a[2 * i + j + step];
-        b[i + j] = u + v; b[i + n / 2 + j] = u - v;
-      }
-      wn = wn * w;
+template<class T> struct NTT {
+  vector<T> rt{1, 1}; T g = 2; decltype(T::mod()) md = T::mod();
+  NTT() { while (g.pow((T::mod() - 1) / 2) == 1) g = g + 1; }
+  void Reserve(int n) { // rt[k + j] = (2k-th root)^j
+    if (md != T::mod()) *this = NTT(); // DynMInt::Set was called
+    for (int k = rt.size(); k < n; k *= 2) {
+      rt.resize(2 * k); auto z = g.pow((T::mod() - 1) / (2 * k));
+      for (int i = k; i < 2 * k; ++i)
+        rt[i] = i % 2 ? rt[i / 2] * z : rt[i / 2];
     }
-    swap(a, b);
   }
-  if (rev) {
-    auto n1 = ModInt(n).inv();
-    for (auto& x : a) x = x * n1;
+  bool Lazy(T* a, int n) { // butterflies on raw .x, kept in [0, 2P)
+    if constexpr (sizeof(T::x) == 4) if (T::mod() < 1u << 30) {
+      uint32_t P = T::mod(), P2 = 2 * P, iv = T::IV ? T::IV : T::iv;
+      for (int k = 1; k < n; k *= 2)
+        for (int i = 0; i < n; i += 2 * k) {
+          T *x = a + i, *y = x + k, *w = rt.data() + k;
+          for (int j = 0; j < k; ++j) {
+            uint64_t t = (uint64_t)w[j].x * y[j].x;
+            uint32_t u = x[j].x, q = uint32_t(t) * iv,
+              v = uint32_t(t >> 32) - uint32_t((uint64_t)q * P >> 32) + P;
+            x[j].x = u + v >= P2 ? u + v - P2 : u + v;
+            y[j].x = u < v ? u - v + P2 : u - v;
+          }
+        }
+      for (int i = 0; i < n; ++i) a[i].x = min(a[i].x, a[i].x - P);
+      return true;
+    }
+    return false;
   }
+  void Run(T* a, int n, bool rev) {
+    Reserve(n);
+    for (int i = 1, j = 0; i < n; ++i) {
+      for (int b = n / 2; (j ^= b) < b; b /= 2);
+      if (i < j) swap(a[i], a[j]);
+    }
+    if (!Lazy(a, n))
+      for (int k = 1; k < n; k *= 2)
+        for (int i = 0; i < n; i += 2 * k)
+          for (int j = i; j < i + k; ++j) {
+            auto z = rt[j - i + k] * a[j + k];
+            a[j + k] = a[j] - z; a[j] = a[j] + z;
+          }
+    if (rev && n) {
+      reverse(a + 1, a + n); auto n1 = T(n).inv();
+      for (int i = 0; i < n; ++i) a[i] = a[i] * n1;
+    }
+  }
+};
+
+template<class T> void DFT(vector<T> &a, bool rev) {
+  static NTT<T> ntt; ntt.Run(a.data(), a.size(), rev);
 }
@@ -0,0 +1,97 @@
+/**
+ * Author: Lucian Bicsi
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: https://arxiv.org/abs/0901.2802 (Bostan, Lecerf, Schost)
+ * Description: Subproduct tree over points $x_0, \ldots, x_{n-1}$.
+ * \texttt{Eval} evaluates a polynomial at all points by repeated
+ * remainders. \texttt{EvalT} does the same with the transposed
+ * (Tellegen) algorithm, which only needs one middle product
+ * per child (about 2x faster). \texttt{Interpolate} finds the
+ * polynomial of degree $< n$ with $p(x_i) = y_i$ ($x_i$ distinct).
+ * Usage: SubproductTree T(x); auto y = T.EvalT(p);
+ * auto q = T.Interpolate(y); // q == p if p.size() <= n
+ * Time: $O(N \log^2 N)$
+ * Status: stress-tested
+ */
+#pragma once
+
+#include "PolyDivRem.h"
+
+// Returns (a * b)[k + |b| - 1] for k < K; needs |a| = K + |b| - 1.
+vector<ModInt> MidProd(vector<ModInt> a, vector<ModInt> b, int K) {
+  int lb = b.size(), n = 1;
+  vector<ModInt> ret(K, 0);
+  if (min(K, lb) <= 32) {
+    for (int k = 0; k < K; ++k)
+      for (int j = 0; j < lb; ++j)
+        ret[k] = ret[k] + a[k + lb - 1 - j] * b[j];
+    return ret;
+  }
+  while (n < (int)a.size()) n *= 2;
+  a.resize(n, 0); b.resize(n, 0);
+  DFT(a, 0); DFT(b, 0);
+  for (int i = 0; i < n; ++i) a[i] = a[i] * b[i];
+  DFT(a, 1);
+  copy(a.begin() + lb - 1, a.begin() + lb - 1 + K, ret.begin());
+  return ret;
+}
+
+struct SubproductTree {
+  int n; vector<ModInt> x; vector<vector<ModInt>> t;
+  SubproductTree(vector<ModInt> x) : n(x.size()), x(x), t(4 * n) {
+    if (n) build(1, 0, n);
+  }
+  void build(int v, int b, int e) { // t[v] = prod (X - x_i)
+    if (e - b == 1) { t[v] = {ModInt(0) - x[b], 1}; return; }
+    int m = (b + e) / 2; build(2 * v, b, m); build(2 * v + 1, m, e);
+    t[v] = Mul(t[2 * v], t[2 * v + 1]);
+  }
+  void eval(int v, int b, int e, vector<ModInt> p, vector<ModInt>& ret) {
+    p = Rem(p, t[v]);
+    if (e - b <= 64) {
+      for (int i = b; i < e; ++i)
+        for (int j = (int)p.size() - 1; j >= 0; --j)
+          ret[i] = ret[i] * x[i] + p[j];
+      return;
+    }
+    int m = (b + e) / 2;
+    eval(2 * v, b, m, p, ret); eval(2 * v + 1, m, e, p, ret);
+  }
+  vector<ModInt> Eval(vector<ModInt> p) {
+    vector<ModInt> ret(n, 0);
+    if (n) eval(1, 0, n, p, ret);
+    return ret;
+  }
+  /// q[k] = sum_j p_j [X^j] X^k / prod (1 - x_i X), i in [b, e)
+  void evalT(int v, int b, int e, vector<ModInt> q, vector<ModInt>& ret) {
+    if (e - b == 1) { ret[b] = q[0]; return; }
+    int m = (b + e) / 2;
+    evalT(2 * v, b, m, MidProd(q, t[2 * v + 1], m - b), ret);
+    evalT(2 * v + 1, m, e, MidProd(q, t[2 * v], e - m), ret);
+  }
+  vector<ModInt> EvalT(vector<ModInt> p) {
+    vector<ModInt> ret(n, 0), r = t[1]; int k = p.size();
+    if (!n || !k) return ret;
+    reverse(r.begin(), r.end()); r = Inv(r, k);
+    reverse(r.begin(), r.end()); p.resize(k + n - 1, 0);
+    evalT(1, 0, n, MidProd(p, r, n), ret);
+    return ret;
+  }
+  vector<ModInt> interp(int v, int b, int e, vector<ModInt>& c) {
+    if (e - b == 1) return {c[b]};
+    int m = (b + e) / 2;
+    auto l = Mul(interp(2 * v, b, m, c), t[2 * v + 1]);
+    auto r = Mul(interp(2 * v + 1, m, e, c), t[2 * v]);
+    for (int i = 0; i < (int)l.size(); ++i) l[i] = l[i] + r[i];
+    return l;
+  }
+  vector<ModInt> Interpolate(vector<ModInt> y) {
+    if (!n) return {};
+    vector<ModInt> d(n);
+    for (int i = 0; i < n; ++i) d[i] = t[1][i + 1] * (i + 1);
+    d = EvalT(d);
+    for (int i = 0; i < n; ++i) d[i] = y[i] / d[i];
+    return interp(1, 0, n, d);
+  }
+};
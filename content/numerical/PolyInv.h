@@ -4,24 +4,33 @@
  * License: CC0
  * Source: https://cp-algorithms.com/algebra/polynomial.html
  * Description: Computes $\bar{a}$ s.t. $deg(\bar{a})=n, a \bar{a} = 1 (\text{mod } X^n)$.
+ * Each Newton step only computes the middle product of $a \bar{a}$,
+ * using 5 transforms of size $2k$ to get from $k$ to $2k$ terms.
+ * \texttt{InvStep} is such a step, reusing buffers \texttt{f}, \texttt{g}.
  * Time: $O(N \log N)$
- * Status: tested manually
+ * Status: stress-tested
  */
 #pragma once
 
 #include "NTT.h"
 
+// b = 1/a mod X^k -> b = 1/a mod X^{2k}
+void InvStep(const vector<ModInt>& a, vector<ModInt>& b,
+    vector<ModInt>& f, vector<ModInt>& g, int k) {
+  f.assign(2 * k, 0); g.assign(2 * k, 0);
+  copy(a.begin(), a.begin() + min(2 * k, (int)a.size()), f.begin());
+  copy(b.begin(), b.begin() + k, g.begin());
+  DFT(f, 0); DFT(g, 0);
+  for (int i = 0; i < 2 * k; ++i) f[i] = f[i] * g[i];
+  DFT(f, 1); fill(f.begin(), f.begin() + k, 0); DFT(f, 0);
+  for (int i = 0; i < 2 * k; ++i) f[i] = f[i] * g[i];
+  DFT(f, 1); b.resize(2 * k);
+  for (int i = k; i < 2 * k; ++i) b[i] = ModInt(0) - f[i];
+}
+
 vector<ModInt> Inv(vector<ModInt> a, int n) {
-  vector<ModInt> ret(1, a[0].inv()), tmp;
-  for (auto& x : a) x = x * (-1);
-  for (int step = 2; step < n * 2; step *= 2) {
-    tmp = a; tmp.resize(4 * step, 0); ret.resize(4 * step, 0);
-    DFT(tmp, 0); DFT(ret, 0);
-    for (int i = 0; i < 4 * step; ++i)
-      ret[i] = (ret[i] * tmp[i] + 2) * ret[i];
-    DFT(ret, 1);
-    ret.resize(step);
-  }
+  vector<ModInt> ret(1, a[0].inv()), f, g;
+  for (int k = 1; k < n; k *= 2) InvStep(a, ret, f, g, k);
   ret.resize(n);
   return ret;
-}
\ No newline at end of file
+}
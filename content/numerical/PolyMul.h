@@ -13,7 +13,7 @@
 
 #include "NTT.h"
 
-vector<ModInt> Mul(vector<ModInt> a, vector<ModInt> b) {
+template<class T> vector<T> Mul(vector<T> a, vector<T> b) {
   if (a.empty() || b.empty()) return {};
   int m = a.size() + b.size() - 1, n = m;
   while (n & (n - 1)) ++n;
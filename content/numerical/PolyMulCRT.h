@@ -0,0 +1,62 @@
+/**
+ * Author: Lucian Bicsi
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: https://cp-algorithms.com/algebra/garners-algorithm.html
+ * Description: Computes $c[x + y] \mathrel{{+}{=}} a[x] \cdot b[y]$ for
+ * any {\tt MOD} $< 2^{31}$ (e.g. $10^9+7$), by convolving modulo three
+ * NTT primes and recombining the results with Garner's form of CRT.
+ * Exact as long as $N \cdot MOD^2 < 7 \cdot 10^{25}$. Below $N = 2^{18}$,
+ * the split FFT \texttt{ConvMod} in "FFT.h" is faster (by 15-30\%);
+ * use this one for larger $N$, or when $N \cdot MOD$ is too big for it.
+ * To multiply many times by the same operand, transform it once
+ * with \texttt{Forward} and reuse the result.
+ * Usage: auto fa = Forward(a, n); // n power of 2, n >= |a| + |b| - 1
+ *  auto c = MulCRT(fa, Forward(b, n), a.size() + b.size() - 1);
+ * Time: $O(N \log N)$
+ * Status: stress-tested
+ */
+#pragma once
+
+#include "FastNTT.h"
+#include "../number-theory/ModInt.h"
+#include "../number-theory/CRT.h"
+
+FastNTT<998244353> N0; FastNTT<167772161> N1; FastNTT<469762049> N2;
+template<class F> void ForEachPrime(F f) { f(N0, 0); f(N1, 1); f(N2, 2); }
+
+struct Fwd { int n; vector<uint32_t> v[3]; };
+Fwd Forward(const vector<ModInt>& a, int n) {
+  Fwd ret{n, {}};
+  ForEachPrime([&](auto& t, int k) {
+    auto& v = ret.v[k]; v.assign(n, 0);
+    for (int i = 0; i < (int)a.size(); ++i)
+      v[i] = a[i].Get() % t.mod;
+    t.Run(v.data(), n, 0);
+  });
+  return ret;
+}
+
+vector<ModInt> MulCRT(const Fwd& a, const Fwd& b, int m) {
+  const ll p0 = N0.mod, p1 = N1.mod, p2 = N2.mod;
+  static ll i1 = (ModInv(p0, p1) + p1) % p1,
+    i2 = (ModInv(p0 * p1 % p2, p2) + p2) % p2;
+  vector<uint32_t> c[3];
+  ForEachPrime([&](auto& t, int k) {
+    c[k] = a.v[k]; t.Dot(c[k].data(), b.v[k].data(), a.n);
+    t.Inverse(c[k].data(), a.n);
+  });
+  vector<ModInt> ret(m);
+  for (int i = 0; i < m; ++i) {
+    ll x = c[0][i], y = (c[1][i] + p1 - x % p1) * i1 % p1;
+    x += p0 * y; y = (c[2][i] + p2 - x % p2) * i2 % p2;
+    ret[i] = (x % MOD + p0 * p1 % MOD * y) % MOD;
+  }
+  return ret;
+}
+vector<ModInt> MulCRT(const vector<ModInt>& a, const vector<ModInt>& b) {
+  if (a.empty() || b.empty()) return {};
+  int m = a.size() + b.size() - 1, n = 1;
+  while (n < m) n *= 2;
+  return MulCRT(Forward(a, n), Forward(b, n), m);
+}
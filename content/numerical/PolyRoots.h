@@ -7,7 +7,8 @@
  * If polynomial has real coefficients, it might make more sense to 
  * initialize roots with conjugate pairs (and potentially one 
  * real root), see (*). It might not converge for all polynomials
- * and all sets of initial roots.
+ * and all sets of initial roots. Stops early once no root moves.
+ * See "PolyRootsAberth.h" for a faster method.
  * Time: $O(N^2)$ per iteration
  * Status: tested by hand
  */
@@ -21,6 +22,7 @@ vector<C> FindRoots(vector<C> p) {
   for (int i = 0; i < n; ++i) 
     ret[i] = pow(C{0.456, 0.976}, i); // (*)
   for (int it = 0; it < 1000; ++it) {
+    double mx = 0;
     for (int i = 0; i < n; ++i) {
       C up = 0, dw = 1;
       for (int j = n; j >= 0; --j) {
@@ -28,8 +30,10 @@ vector<C> FindRoots(vector<C> p) {
         if (j != i && j != n) 
           dw = dw * (ret[i] - ret[j]);
       }
-      ret[i] -= up / dw / p[n];
+      C d = up / dw / p[n];
+      ret[i] -= d; mx = max(mx, abs(d) / max(1., abs(ret[i])));
     }
+    if (mx < 1e-15) break;
   }
   return ret;
 }
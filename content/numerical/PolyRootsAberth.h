@@ -0,0 +1,91 @@
+/**
+ * Author: Lucian Bicsi
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: Bini - Numerical computation of polynomial zeros by means of
+ * Aberth's method
+ * Description: Finds all complex roots of $p$ (\texttt{p[i]} is the
+ * coefficient of $x^i$) by Aberth-Ehrlich iteration,
+ * $z_i \mathrel{{-}{=}} w_i / (1 - w_i \sum_{j \neq i} \frac{1}{z_i - z_j})$
+ * with $w_i = p(z_i) / p'(z_i)$. Roots start on circles given by the
+ * upper hull of $(i, \log |p_i|)$: a Cauchy-type bound per group of roots
+ * of similar size (one circle for random $p$; a single outer circle
+ * needs $O(N)$ iterations to shrink). A root is frozen once $|p(z_i)|$ is
+ * at rounding level or its step is below \texttt{eps} relative;
+ * stops when all are. $p / p'$ is taken on the reversed polynomial for
+ * $|z| > 1$, so high degrees do not overflow. With \texttt{fft}, the
+ * first sweep (points on the circles) is evaluated by DFTs.
+ * Converges cubically for simple roots, linearly for multiple ones.
+ * Time: O(N^2) per iteration, usually $O(\log N)$ iterations
+ * (around 0.6s for $N = 2000$)
+ * Status: stress-tested
+ */
+#pragma once
+
+#include "FFT.h"
+
+vector<C> FindRootsAberth(vector<C> p, bool fft = false,
+    double eps = 1e-14) {
+  while (p.size() > 1 && p.back() == C(0)) p.pop_back();
+  int z0 = 0, n = (int)p.size() - 1;
+  while (z0 < n && p[z0] == C(0)) ++z0;
+  p.erase(p.begin(), p.begin() + z0); n -= z0;
+  if (n < 1) return vector<C>(z0, 0);
+  /// Upper hull of (i, log |p_i|): an edge (a, b) gets b - a points
+  /// on a circle of radius (|p_a| / |p_b|)^{1 / (b - a)}
+  vector<int> h; vector<double> L(n + 1);
+  for (int i = 0; i <= n; ++i) {
+    if (p[i] == C(0)) continue;
+    L[i] = log(abs(p[i]));
+    while (h.size() > 1 && (L[h.back()] - L[h.end()[-2]]) * (i - h.back())
+        <= (L[i] - L[h.back()]) * (h.back() - h.end()[-2])) h.pop_back();
+    h.push_back(i);
+  }
+  vector<C> z(n), W(n); double PI = acos(-1);
+  for (int e = 0; e + 1 < (int)h.size(); ++e) {
+    int a = h[e], m = h[e + 1] - a, M = fft ? 1 : m;
+    double lu = (L[a] - L[a + m]) / m, th = 0.4 + e;
+    while (M < m) M *= 2;
+    for (int k = 0; k < m; ++k)
+      z[a + k] = exp(C(lu, th + 2 * PI * (int)((ll)k * M / m) / M));
+    if (!fft) continue;
+    /// p(z) and z p'(z) on the circle, scaled by 1 / (|p_a| u^a)
+    vector<C> P(M), D(M);
+    for (int j = 0; j <= n; ++j) if (p[j] != C(0)) {
+      C t = p[j] / abs(p[j]) * exp(C(L[j] - L[a] + (j - a) * lu, j * th));
+      P[j % M] += t; D[j % M] += double(j) * t;
+    }
+    DFT(P, 0); DFT(D, 0);
+    for (int k = 0; k < m; ++k) {
+      int i = (int)((ll)k * M / m);
+      W[a + k] = z[a + k] * P[i] / D[i];
+    }
+  }
+  vector<bool> done(n); int left = n;
+  auto ratio = [&](C x, int i) { // p(x) / p'(x), freezes x if p(x) ~ 0
+    C v = p[n], d = 0; double e = abs(v), ax = abs(x);
+    if (ax <= 1) {
+      for (int k = n - 1; k >= 0; --k)
+        d = d * x + v, v = v * x + p[k], e = e * ax + abs(p[k]);
+    } else {
+      C y = 1. / x; v = p[0]; e = abs(v); // y^n p(1 / y)
+      for (int k = 1; k <= n; ++k)
+        d = d * y + v, v = v * y + p[k], e = e / ax + abs(p[k]);
+      d = (double(n) * v - y * d) / x;
+    }
+    if (abs(v) <= 4 * n * 1e-16 * e) done[i] = 1, --left;
+    return v / d;
+  };
+  for (int it = 0; it < 500 && left; ++it)
+    for (int i = 0; i < n; ++i) if (!done[i]) {
+      C w = it == 0 && fft ? W[i] : ratio(z[i], i), s = 0;
+      for (int j = 0; j < n; ++j)
+        if (j != i) { C d = z[i] - z[j]; s += conj(d) / norm(d); }
+      C d = w / (1. - w * s);
+      if (isnan(d.real()) || isnan(d.imag())) d = 0;
+      z[i] -= d;
+      if (!done[i] && abs(d) <= eps * max(1., abs(z[i]))) done[i] = 1, --left;
+    }
+  z.resize(n + z0, 0);
+  return z;
+}
@@ -0,0 +1,130 @@
+/**
+ * Author: Lucian Bicsi
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: https://arxiv.org/abs/1301.5804 (Hanrot, Zimmermann)
+ * Description: Power series operations modulo $X^n$.
+ * \texttt{Log} needs $a_0 = 1$, \texttt{Exp} needs $a_0 = 0$, both
+ * need {\tt MOD} $> n$ prime (they divide by $i \le n$).
+ * \texttt{Sqrt} needs $s_0^2 = a_0 \neq 0$ and {\tt MOD} an odd prime.
+ * \texttt{Exp} and \texttt{Sqrt} carry the inverse of the result
+ * along (see "PolyInv.h") and only compute the new half of each
+ * product, for 10.5 (resp. 7.5) transforms of size $2k$ per step.
+ * The inverses $1/i$ are kept in a static table, grown on demand.
+ * \texttt{Compose} computes $a(b(X))$ by baby-step giant-step.
+ * Time: $O(N \log N)$ (about 1s for \texttt{Exp} with $N = 10^6$),
+ * \texttt{Compose} is $O(N^2 + N \sqrt{N} \log N)$
+ * Status: stress-tested
+ */
+#pragma once
+
+#include "PolyMul.h"
+#include "PolyInv.h"
+
+const vector<ModInt>& Invs(int n) { // 1/i for i < n, grown on demand
+  static vector<ModInt> iv{0, 1};
+  for (int i = iv.size(); i < n; ++i)
+    iv.push_back(ModInt(0) - iv[MOD % i] * (MOD / i));
+  return iv;
+}
+vector<ModInt> Integr(vector<ModInt> a) { // result has a0 = 0
+  int n = a.size() + 1; auto& iv = Invs(n);
+  a.insert(a.begin(), 0);
+  for (int i = 1; i < n; ++i) a[i] = a[i] * iv[i];
+  return a;
+}
+vector<ModInt> Deriv(vector<ModInt> a) {
+  for (int i = 1; i < (int)a.size(); ++i) a[i - 1] = a[i] * i;
+  if (a.size()) a.pop_back();
+  return a;
+}
+
+vector<ModInt> Log(vector<ModInt> a, int n) {
+  if (n <= 0) return {};
+  auto ret = Mul(Deriv(a), Inv(a, n));
+  ret.resize(n - 1);
+  return Integr(ret);
+}
+
+vector<ModInt> Exp(vector<ModInt> h, int n) {
+  vector<ModInt> f{1}, g{1}, F, T, U, V;
+  for (int m = 1; m < n; m *= 2) {
+    if (m > 1) InvStep(f, g, U, V, m / 2); // g = 1/f mod X^m
+    h.resize(max((int)h.size(), 2 * m), 0);
+    /// q = h', w = q + g (f' - f q) = (log f)' mod X^{2m - 1}
+    F.assign(2 * m, 0); T.assign(2 * m, 0);
+    copy(f.begin(), f.end(), F.begin());
+    for (int i = 0; i < m - 1; ++i) T[i] = h[i + 1] * (i + 1);
+    DFT(F, 0); DFT(T, 0);
+    for (int i = 0; i < 2 * m; ++i) T[i] = T[i] * F[i];
+    DFT(T, 1); U.assign(2 * m, 0); V.assign(2 * m, 0);
+    for (int i = 0; i < m - 1; ++i) U[i] = ModInt(0) - T[i + m - 1];
+    copy(g.begin(), g.end(), V.begin());
+    DFT(U, 0); DFT(V, 0);
+    for (int i = 0; i < 2 * m; ++i) U[i] = U[i] * V[i];
+    DFT(U, 1);
+    /// f += f (h - int w), where (h - int w) = 0 mod X^m
+    auto& iv = Invs(2 * m); T.assign(2 * m, 0);
+    for (int i = 0; i < m; ++i) T[i] = h[i + m] - U[i] * iv[i + m];
+    DFT(T, 0);
+    for (int i = 0; i < 2 * m; ++i) T[i] = T[i] * F[i];
+    DFT(T, 1); f.resize(2 * m);
+    for (int i = 0; i < m; ++i) f[i + m] = T[i];
+  }
+  f.resize(n);
+  return f;
+}
+
+vector<ModInt> Sqrt(vector<ModInt> a, int n, ModInt s0 = 1) {
+  vector<ModInt> s{s0}, g{s0.inv()}, T, U, V;
+  auto i2 = ModInt(2).inv();
+  for (int k = 1; k < n; k *= 2) {
+    if (k > 1) InvStep(s, g, U, V, k / 2); // g = 1/s mod X^k
+    a.resize(max((int)a.size(), 2 * k), 0);
+    T.assign(2 * k, 0); copy(s.begin(), s.end(), T.begin());
+    DFT(T, 0);
+    for (int i = 0; i < 2 * k; ++i) T[i] = T[i] * T[i];
+    DFT(T, 1); U.assign(2 * k, 0); V.assign(2 * k, 0);
+    for (int i = 0; i < k; ++i) U[i] = T[i + k] - a[i + k];
+    copy(g.begin(), g.end(), V.begin());
+    DFT(U, 0); DFT(V, 0);
+    for (int i = 0; i < 2 * k; ++i) U[i] = U[i] * V[i];
+    DFT(U, 1); s.resize(2 * k);
+    for (int i = 0; i < k; ++i) s[i + k] = ModInt(0) - U[i] * i2;
+  }
+  s.resize(n);
+  return s;
+}
+
+vector<ModInt> Pow(vector<ModInt> a, ll k, int n) {
+  if (n <= 0) return {};
+  vector<ModInt> ret(n, 0); int z = 0; a.resize(n, 0);
+  if (!k) return ret[0] = 1, ret;
+  while (z < n && a[z] == 0) ++z;
+  if (z == n || (z && k >= (n + z - 1) / z)) return ret;
+  a.erase(a.begin(), a.begin() + z);
+  auto c = a[0], ic = c.inv(), km = ModInt(k % MOD);
+  for (auto& x : a) x = x * ic;
+  a = Log(a, n - z * k);
+  for (auto& x : a) x = x * km;
+  a = Exp(a, n - z * k); c = c.pow(k);
+  for (int i = 0; i < (int)a.size(); ++i) ret[i + z * k] = a[i] * c;
+  return ret;
+}
+
+vector<ModInt> Compose(vector<ModInt> a, vector<ModInt> b, int n) {
+  int d = a.size(), s = sqrt(d) + 1;
+  b.resize(n, 0);
+  vector<vector<ModInt>> pw(s + 1, vector<ModInt>(n, 0));
+  pw[0][0] = 1;
+  for (int i = 1; i <= s; ++i)
+    pw[i] = Mul(pw[i - 1], b), pw[i].resize(n);
+  vector<ModInt> ret(n, 0);
+  for (int i = (d - 1) / s; i >= 0; --i) {
+    ret = Mul(ret, pw[s]); ret.resize(n);
+    for (int j = 0; j < s && i * s + j < d; ++j)
+      for (int l = 0; l < n; ++l)
+        ret[l] = ret[l] + a[i * s + j] * pw[j][l];
+  }
+  return ret;
+}
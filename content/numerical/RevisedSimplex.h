@@ -0,0 +1,182 @@
+/**
+ * Author: Lucian Bicsi
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: Maros - Computational Techniques of the Simplex Method
+ * Description: Maximizes $c^T x$ subject to $lr_i \le (Ax)_i \le ur_i$ and
+ * $l_j \le x_j \le u_j$ (bounds may be infinite, default $0 \le x$ and
+ * free rows). $A$ is kept as sparse columns. The basis inverse
+ * is a product of eta matrices, one per pivot. It is refactored (columns
+ * sparsest first, pivot in the sparsest row among large entries) when
+ * the etas added since then outgrow the refactored ones.
+ * Phase 1 minimizes the sum of bound violations, so \texttt{Solve()} can
+ * be called again after changing $c$ or the bounds, starting from the
+ * last basis. Pricing is partial, the ratio test is Harris'.
+ * Returns -inf if infeasible, inf if unbounded, else the optimum
+ * (with $x$ set to an optimal point).
+ * Usage: RevisedSimplex lp(m, n); lp.Add(i, j, 2.5); lp.Row(i, -lp.inf, 4);
+ * lp.c[j] = 1; double val = lp.Solve(); // lp.x[j]
+ * Time: O(nnz + m + \text{eta size}) per pivot, \#pivots usually $O(m)$
+ * (around 2.5s cold, 0.5s warm for a random $5000 \times 5000$, 5 per column)
+ * Status: stress-tested
+ */
+#pragma once
+
+struct RevisedSimplex {
+  struct Eta { int r; double p; vector<pair<int, double>> a; };
+  double inf = 1 / .0, eps = 1e-9, tol = 1e-7;
+  int m, n, pp = 0; // structurals are [0, n), slacks n + i
+  long long fill = 0, grow = 0; // eta sizes: at refactor, since then
+  vector<vector<pair<int, double>>> col;
+  vector<double> lo, hi, c, x, w;
+  vector<int> head, pos; vector<Eta> etas;
+
+  RevisedSimplex(int m, int n) : m(m), n(n), col(n + m), lo(n + m, 0),
+      hi(n + m, inf), c(n + m, 0), x(n + m, 0), w(m, 0), head(m),
+      pos(n + m, -1) {
+    for (int i = 0; i < m; ++i) // A x + s = 0
+      col[n + i] = {{i, 1}}, lo[n + i] = -inf, head[i] = n + i, pos[n + i] = i;
+  }
+  void Add(int i, int j, double v) { col[j].push_back({i, v}); }
+  void Row(int i, double l, double u) { lo[n + i] = -u; hi[n + i] = -l; }
+  void Bound(int j, double l, double u) { lo[j] = l; hi[j] = u; }
+
+  /// w = B^{-1} a (w is sparse, returns its support)
+  vector<int> ftran(const vector<pair<int, double>>& a) {
+    vector<int> nz;
+    for (auto [i, v] : a) { if (w[i] == 0) nz.push_back(i); w[i] += v; }
+    for (auto& e : etas) {
+      double v = w[e.r];
+      if (v == 0) continue;
+      w[e.r] = v /= e.p;
+      for (auto [i, x] : e.a) { if (w[i] == 0) nz.push_back(i); w[i] -= x * v; }
+    }
+    sort(nz.begin(), nz.end());
+    nz.erase(unique(nz.begin(), nz.end()), nz.end());
+    return nz;
+  }
+  void btran(vector<double>& y) {
+    for (int k = (int)etas.size() - 1; k >= 0; --k) {
+      auto& e = etas[k]; double s = y[e.r];
+      for (auto [i, a] : e.a) s -= a * y[i];
+      y[e.r] = s / e.p;
+    }
+  }
+  void eta(int r, vector<int>& nz) {
+    Eta e{r, w[r], {}};
+    for (int i : nz) {
+      if (i != r && abs(w[i]) > eps) e.a.push_back({i, w[i]});
+      w[i] = 0;
+    }
+    etas.push_back(e); grow += (int)e.a.size() + 1;
+  }
+  void refactor() {
+    vector<int> cols; vector<bool> taken(m);
+    for (int r = 0; r < m; ++r) {
+      int j = head[r]; pos[j] = -1;
+      if (j >= n) taken[j - n] = true;
+      else cols.push_back(j);
+    }
+    sort(cols.begin(), cols.end(), [&](int a, int b) {
+      return col[a].size() < col[b].size();
+    });
+    vector<int> cnt(m); // entries left in each row
+    for (int j : cols) for (auto [i, v] : col[j]) ++cnt[i];
+    etas.clear(); grow = 0;
+    for (int i = 0; i < m; ++i) head[i] = n + i;
+    for (int j : cols) {
+      auto nz = ftran(col[j]); int r = -1;
+      double mx = 1e-6; // sparsest row among the large pivots
+      for (int i : nz) if (!taken[i]) mx = max(mx, abs(w[i]) / 10);
+      for (int i : nz)
+        if (!taken[i] && abs(w[i]) >= mx && (r < 0 || cnt[i] < cnt[r])) r = i;
+      for (auto [i, v] : col[j]) --cnt[i];
+      if (r < 0) { for (int i : nz) w[i] = 0; continue; } // singular
+      eta(r, nz); taken[r] = true; head[r] = j;
+    }
+    for (int r = 0; r < m; ++r) pos[head[r]] = r;
+    fill = grow + m; grow = 0;
+    /// x_B = -B^{-1} N x_N
+    vector<pair<int, double>> rhs;
+    for (int j = 0; j < n + m; ++j) if (pos[j] < 0) {
+      if (lo[j] > -inf && (hi[j] == inf || x[j] - lo[j] <= hi[j] - x[j]))
+        x[j] = lo[j];
+      else x[j] = hi[j] < inf ? hi[j] : 0;
+      if (x[j] != 0) for (auto [i, v] : col[j]) rhs.push_back({i, -v * x[j]});
+    }
+    auto nz = ftran(rhs);
+    for (int r = 0; r < m; ++r) x[head[r]] = 0;
+    for (int i : nz) x[head[i]] = w[i], w[i] = 0;
+  }
+  int state(int j) { // -1 below bounds, 1 above, 0 feasible
+    return x[j] < lo[j] - tol ? -1 : x[j] > hi[j] + tol;
+  }
+
+  double Solve() {
+    refactor();
+    vector<double> y(m);
+    while (true) {
+      bool p1 = false;
+      for (int r = 0; r < m; ++r) {
+        int s = state(head[r]);
+        y[r] = s ? -s : c[head[r]], p1 |= s != 0;
+      }
+      if (p1) for (int r = 0; r < m; ++r) if (!state(head[r])) y[r] = 0;
+      btran(y);
+      /// Partial pricing, in chunks, from where we last stopped
+      int q = -1, N = n + m, K = max(N / 8, min(N, 1000)); double best = 0;
+      for (int k = 0; k < N && (q < 0 || k % K); ++k) {
+        int j = (pp + k) % N;
+        if (pos[j] >= 0 || lo[j] == hi[j]) continue;
+        double d = p1 ? 0 : c[j];
+        for (auto [i, v] : col[j]) d -= y[i] * v;
+        if ((d > tol && x[j] < hi[j]) || (d < -tol && x[j] > lo[j]))
+          if (abs(d) > best) best = abs(d), q = j;
+      }
+      if (q < 0) {
+        if (p1) return -inf;
+        double val = 0;
+        for (int j = 0; j < n; ++j) val += c[j] * x[j];
+        return val;
+      }
+      pp = (q + 1) % N;
+      double d = p1 ? 0 : c[q];
+      for (auto [i, v] : col[q]) d -= y[i] * v;
+      int dir = d > 0 ? 1 : -1;
+      auto nz = ftran(col[q]);
+      /// Harris ratio test; infeasible basics may only move to bounds
+      auto bound = [&](int i) {
+        int j = head[i], s = state(j);
+        return dir * w[i] > 0 ? (s > 0 ? hi[j] : s < 0 ? -inf : lo[j])
+                              : (s < 0 ? lo[j] : s > 0 ? inf : hi[j]);
+      };
+      auto lim = [&](int i, double t) {
+        if (abs(w[i]) <= eps) return inf;
+        double rate = -dir * w[i];
+        return (bound(i) - x[head[i]] + (rate < 0 ? -t : t)) / rate;
+      };
+      double tmax = inf, t = hi[q] - lo[q]; int r = -1;
+      for (int i : nz) tmax = min(tmax, lim(i, tol));
+      if (t > tmax)
+        for (int i : nz)
+          if (lim(i, 0) <= tmax && (r < 0 || abs(w[i]) > abs(w[r])))
+            r = i, t = max(lim(i, 0), 0.);
+      if (t == inf) {
+        for (int i : nz) w[i] = 0;
+        return p1 ? -inf : inf;
+      }
+      double b = r < 0 ? 0 : bound(r);
+      x[q] += dir * t;
+      for (int i : nz) x[head[i]] -= dir * t * w[i];
+      if (r < 0) { // bound flip
+        x[q] = dir > 0 ? hi[q] : lo[q];
+        for (int i : nz) w[i] = 0;
+        continue;
+      }
+      int p = head[r];
+      eta(r, nz);
+      x[p] = b; pos[p] = -1; head[r] = q; pos[q] = r;
+      if (grow > fill) refactor();
+    }
+  }
+};
@@ -0,0 +1,81 @@
+/**
+ * Author: Lucian Bicsi
+ * Date: 2026-10-17
+ * License: CC0
+ * Source: Albrecht, Bard, Hart - Algorithm 898: Efficient
+ * Multiplication of Dense Matrices over GF(2) (M4RI)
+ * Description: Same as "RowEchelon.h", over GF(2). Rows are packed
+ * in 64-bit words. Columns are taken 8 at a time (Four Russians):
+ * the pivots of the group are found by looking only at those 8 bits,
+ * then every other row is cleared by a single XOR with one of the
+ * $2^8$ sums of pivot rows. \texttt{SolveLinear} takes $[M|b]$.
+ * Usage: BitMatrix A(n, m + 1); A.flip(i, j); ... SolveLinear(A);
+ * Time: O(N M^2 / 512) (around 1.5s for $N = M = 10^4$)
+ * Status: stress-tested
+ */
+#pragma once
+
+using u64 = uint64_t;
+
+struct BitMatrix {
+  int n, m, w; vector<u64> a;
+  BitMatrix(int n, int m) : n(n), m(m), w((m + 63) / 64), a((size_t)n * w) {}
+  u64* operator[](int i) { return &a[(size_t)i * w]; }
+  bool get(int i, int j) { return (*this)[i][j / 64] >> (j % 64) & 1; }
+  void flip(int i, int j) { (*this)[i][j / 64] ^= 1ULL << (j % 64); }
+};
+
+pair<vector<int>, int> RowEchelon(BitMatrix& A) {
+  int n = A.n, w = A.w, sgn = 1, rnk = 0;
+  vector<int> piv; vector<u64> T(256 * w);
+  auto win = [&](int i, int c) { return int(A[i][c / 64] >> (c % 64) & 255); };
+  auto xr = [&](u64* x, u64* y, int from) {
+    for (int k = from; k < w; ++k) x[k] ^= y[k];
+  };
+  for (int c = 0; c < A.m && rnk < n; c += 8) {
+    int r0 = rnk, q = 0, f = c / 64;
+    /// Pivots of columns [c, c + 8), kept reduced among themselves
+    for (int b = 0; b < 8 && c + b < A.m && rnk < n; ++b) {
+      int p = rnk;
+      for (; p < n; ++p) {
+        int x = win(p, c);
+        for (int t = 0; t < q; ++t)
+          if (x >> (piv[r0 + t] - c) & 1) x ^= win(r0 + t, c);
+        if (x >> b & 1) break;
+      }
+      if (p == n) continue;
+      if (p != rnk) swap_ranges(A[p], A[p] + w, A[rnk]), sgn = -sgn;
+      for (int t = 0; t < q; ++t)
+        if (A.get(rnk, piv[r0 + t])) xr(A[rnk], A[r0 + t], f);
+      for (int t = 0; t < q; ++t)
+        if (A.get(r0 + t, c + b)) xr(A[r0 + t], A[rnk], f);
+      piv.push_back(c + b); ++rnk; ++q;
+    }
+    if (!q) continue;
+    /// T[s] = sum of pivot rows in s, idx[window] = pivots in window
+    vector<int> idx(256, 0);
+    for (int s = 1; s < (1 << q); ++s) {
+      int t = __builtin_ctz(s);
+      for (int k = f; k < w; ++k)
+        T[s * w + k] = T[(s & (s - 1)) * w + k] ^ A[r0 + t][k];
+    }
+    for (int x = 0; x < 256; ++x)
+      for (int t = 0; t < q; ++t)
+        if (x >> (piv[r0 + t] - c) & 1) idx[x] |= 1 << t;
+    for (int j = 0; j < n; ++j) {
+      if (j == r0) j = rnk;
+      if (j == n) break;
+      if (int s = idx[win(j, c)]) xr(A[j], &T[s * w], f);
+    }
+  }
+  return {piv, sgn};
+}
+
+vector<int> SolveLinear(BitMatrix& A) {
+  int m = A.m - 1;
+  auto piv = RowEchelon(A).first;
+  if (piv.size() && piv.back() == m) return {};
+  vector<int> sol(m, 0);
+  for (int i = 0; i < (int)piv.size(); ++i) sol[piv[i]] = A.get(i, m);
+  return sol;
+}
@@ -0,0 +1,47 @@
+/**
+ * Author: Lucian Bicsi
+ * Date: 2026-10-17
+ * License: CC0
+ * Description: Same as "RowEchelon.h", exactly over $\mathbb{Z}_p$
+ * ({\tt MOD} prime). Any non-zero pivot is fine, and the pivot row is
+ * inverted once. Determinant is \texttt{sgn} times the product of
+ * the diagonal, as in "MatrixDeterminant.h". \texttt{SolveLinear}
+ * takes $[M|b]$ and returns an empty vector if there is no solution.
+ * Time: O(M^2 N)
+ * Status: stress-tested
+ */
+#pragma once
+
+#include "../number-theory/ModInt.h"
+
+using matm = vector<vector<ModInt>>;
+
+pair<vector<int>, int> RowEchelon(matm& A) {
+  int n = A.size(), m = A[0].size(), sgn = 1;
+  vector<int> piv;
+  for (int i = 0, rnk = 0; i < m && rnk < n; ++i) {
+    int p = rnk;
+    while (p < n && A[p][i] == 0) ++p;
+    if (p == n) continue;
+    if (p != rnk) swap(A[p], A[rnk]), sgn = -sgn;
+    auto inv = A[rnk][i].inv();
+    for (int j = 0; j < n; ++j) {
+      if (j == rnk || A[j][i] == 0) continue;
+      auto coef = A[j][i] * inv;
+      for (int k = i; k < m; ++k)
+        A[j][k] = A[j][k] - coef * A[rnk][k];
+    }
+    piv.push_back(i); ++rnk;
+  }
+  return {piv, sgn};
+}
+
+vector<ModInt> SolveLinear(matm& A) {
+  int m = A[0].size() - 1;
+  auto piv = RowEchelon(A).first;
+  if (piv.size() && piv.back() == m) return {};
+  vector<ModInt> sol(m, 0);
+  for (int i = 0; i < (int)piv.size(); ++i)
+    sol[piv[i]] = A[i][m] / A[i][piv[i]];
+  return sol;
+}
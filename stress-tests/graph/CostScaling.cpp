@@ -0,0 +1,135 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../../content/graph/CostScaling.h"
+namespace mfmc {
+#include "../../content/graph/MinCostMaxFlow.h"
+}
+namespace ns {
+#include "../../content/graph/NetworkSimplex.h"
+}
+
+mt19937 rng(17);
+
+/// max flow, then cancel negative residual cycles found by Bellman-Ford
+ll brute(int n, vector<array<int, 4>>& ed, int s, int t) {
+	DinicCSR D(n);
+	for (auto [a, b, cap, c] : ed) D.AddEdge(a, b, cap);
+	D.Compute(s, t);
+	auto& A = D.A; vector<ll> c(sz(A));
+	rep(e,0,sz(ed)) c[D.pos[e]] = ed[e][3], c[A[D.pos[e]].rev] = -ed[e][3];
+	while (true) {
+		vector<ll> d(n, 0); vi pa(n, -1), from(sz(A));
+		rep(u,0,n) rep(a,D.st[u],D.st[u + 1]) from[a] = u;
+		int x = -1;
+		rep(it,0,n) {
+			x = -1;
+			rep(a,0,sz(A)) if (A[a].cap > 0 && d[from[a]] + c[a] < d[A[a].to])
+				d[A[a].to] = d[from[a]] + c[a], pa[A[a].to] = a, x = A[a].to;
+		}
+		if (x < 0) break;
+		rep(i,0,n) x = from[pa[x]];
+		T f = INT_MAX;
+		for (int v = x;; ) { f = min(f, A[pa[v]].cap); v = from[pa[v]]; if (v == x) break; }
+		for (int v = x;; ) {
+			A[pa[v]].cap -= f; A[A[pa[v]].rev].cap += f;
+			v = from[pa[v]]; if (v == x) break;
+		}
+	}
+	ll r = 0;
+	rep(e,0,sz(ed)) r += (ll)ed[e][3] * D.Flow(e);
+	return r;
+}
+
+int main() {
+	rep(it,0,100000) {
+		int n = 2 + rng() % 8, m = rng() % 25, mc = rng() % 2 ? 3 : 1000;
+		int s = rng() % n, t = rng() % (n - 1);
+		if (t >= s) t++;
+		CostScaling C(n); mfmc::MFMC M(n);
+		vector<array<int, 4>> ed;
+		rep(i,0,m) {
+			int a = rng() % n, b = rng() % n, cap = rng() % 10, c = rng() % mc;
+			if (a == b) continue;
+			ed.push_back({a, b, cap, c});
+			C.AddEdge(a, b, cap, c); M.AddEdge(a, b, cap, c);
+		}
+		auto [f, c] = C.Compute(s, t);
+		auto [f2, c2] = M.Compute(s, t);
+		assert(f == f2 && c == c2);
+		vector<ll> bal(n); ll cost = 0;
+		rep(i,0,sz(ed)) {
+			auto [a, b, cap, k] = ed[i];
+			T x = C.D.Flow(i);
+			assert(0 <= x && x <= cap);
+			bal[a] -= x; bal[b] += x; cost += (ll)x * k;
+		}
+		rep(i,0,n) assert(bal[i] == (i == s ? -f : i == t ? f : 0));
+		assert(cost == c);
+	}
+	rep(it,0,30000) { // negative costs and negative cycles
+		int n = 2 + rng() % 7, m = rng() % 20, mc = rng() % 2 ? 3 : 1000;
+		int s = rng() % n, t = rng() % (n - 1);
+		if (t >= s) t++;
+		CostScaling C(n);
+		vector<array<int, 4>> ed;
+		rep(i,0,m) {
+			int a = rng() % n, b = rng() % n, cap = rng() % 10;
+			int c = int(rng() % (2 * mc + 1)) - mc;
+			if (a == b) continue;
+			ed.push_back({a, b, cap, c});
+			C.AddEdge(a, b, cap, c);
+		}
+		auto [f, c] = C.Compute(s, t);
+		assert(c == brute(n, ed, s, t));
+		vector<ll> bal(n);
+		rep(i,0,sz(ed)) {
+			T x = C.D.Flow(i);
+			assert(0 <= x && x <= ed[i][2]);
+			bal[ed[i][0]] -= x; bal[ed[i][1]] += x;
+		}
+		rep(i,0,n) assert(bal[i] == (i == s ? -f : i == t ? f : 0));
+	}
+	{ // one node collects many saturated negative arcs: excess > INT_MAX
+		int n = 4, s = 0, t = 3;
+		CostScaling C(n);
+		rep(i,0,5) C.AddEdge(1, 2, 1'000'000'000, -1);
+		C.AddEdge(2, 1, 2'000'000'000, -1);
+		C.AddEdge(2, 1, 2'000'000'000, -1);
+		auto [f, c] = C.Compute(s, t);
+		assert(f == 0 && c == -8'000'000'000LL);
+	}
+
+	/// transportation: 300 suppliers, 300 consumers, 10^7 units
+	int k = 300, n = 2 * k + 2, s = n - 2, t = n - 1;
+	vector<array<int, 4>> ed;
+	rep(i,0,k) {
+		ed.push_back({s, i, int(rng() % 66667), 0});
+		ed.push_back({k + i, t, int(rng() % 66667), 0});
+	}
+	rep(i,0,k) rep(j,0,k) ed.push_back({i, k + j, int(rng() % 2000), int(rng() % 100)});
+	pair<ll, ll> r1, r2; ll r3;
+	{
+		CostScaling C(n);
+		for (auto [a, b, cap, c] : ed) C.AddEdge(a, b, cap, c);
+		timeit tm("CostScaling");
+		r1 = C.Compute(s, t);
+	}
+	{
+		mfmc::MFMC M(n);
+		for (auto [a, b, cap, c] : ed) M.AddEdge(a, b, cap, c);
+		timeit tm("MFMC");
+		r2 = M.Compute(s, t);
+	}
+	{
+		ns::NetworkSimplex N(n);
+		for (auto [a, b, cap, c] : ed) N.AddEdge(a, b, cap, c);
+		int big = 300, e = N.AddEdge(t, s, (int)r1.first + 1, -big); // > any path cost
+		timeit tm("NetworkSimplex");
+		r3 = N.Compute();
+		assert(N.E[e].f == r1.first);
+		r3 += (ll)big * r1.first;
+	}
+	assert(r1 == r2 && r1.second == r3);
+	cout<<"Tests passed!"<<endl;
+}
@@ -0,0 +1,66 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../../content/graph/DinicFlow.h"
+#include "../../content/graph/DinicCSR.h"
+
+mt19937 rng(5);
+
+int main() {
+	rep(it,0,100000) {
+		int n = 2 + rng() % 10, m = rng() % 40;
+		int s = rng() % n, t = rng() % (n - 1);
+		if (t >= s) t++;
+		Dinic D(n); DinicCSR F(n);
+		vector<array<int, 4>> ed;
+		rep(i,0,m) {
+			int a = rng() % n, b = rng() % n, c = rng() % 5, dir = rng() % 3 > 0;
+			ed.push_back({a, b, c, dir});
+			D.AddEdge(a, b, c, dir);
+			assert(F.AddEdge(a, b, c, dir) == i);
+		}
+		T f = F.Compute(s, t);
+		assert(f == D.Compute(s, t));
+		vector<T> bal(n); T cut = 0;
+		rep(i,0,m) {
+			auto [a, b, c, dir] = ed[i];
+			T x = F.Flow(i);
+			assert(x <= c && (dir ? x >= 0 : x >= -c));
+			bal[a] -= x; bal[b] += x;
+			if (!F.SideOfCut(a) && F.SideOfCut(b)) cut += c;
+			if (!dir && F.SideOfCut(a) && !F.SideOfCut(b)) cut += c;
+		}
+		rep(i,0,n) assert(bal[i] == (i == s ? -f : i == t ? f : 0));
+		assert(!F.SideOfCut(s) && F.SideOfCut(t) && cut == f);
+	}
+
+	{ // a path of 10^6 nodes would overflow the recursive dfs
+		int n = 1000000;
+		DinicCSR F(n);
+		rep(i,0,n - 1) F.AddEdge(i, i + 1, 2);
+		assert(F.Compute(0, n - 1) == 2);
+	}
+
+	int n = 200000, m = 2000000;
+	vector<array<int, 3>> ed;
+	rep(i,0,m) {
+		int a = rng() % n, b = rng() % n;
+		if (a > b) swap(a, b); // mostly forward, so long paths
+		ed.push_back({a, b, int(rng() % 100)});
+	}
+	T r1, r2;
+	{
+		timeit t("Dinic");
+		Dinic D(n);
+		for (auto [a, b, c] : ed) D.AddEdge(a, b, c);
+		r1 = D.Compute(0, n - 1);
+	}
+	{
+		timeit t("DinicCSR");
+		DinicCSR F(n);
+		for (auto [a, b, c] : ed) F.AddEdge(a, b, c);
+		r2 = F.Compute(0, n - 1);
+	}
+	assert(r1 == r2);
+	cout<<"Tests passed!"<<endl;
+}
@@ -0,0 +1,100 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../../content/graph/DinicFlow.h"
+
+mt19937 rng(9);
+
+struct G { int n; vector<array<int, 4>> ed; };
+
+T fresh(const G& g, int s, int t) {
+	Dinic D(g.n);
+	for (auto [a, b, c, dir] : g.ed) D.AddEdge(a, b, c, dir);
+	return D.Compute(s, t);
+}
+
+void check(Dinic& D, int n, int s, int t, T flow) {
+	vector<T> bal(n);
+	for (auto& e : D.es) {
+		assert(e.flow <= e.cap);
+		if (e.flow > 0) bal[e.from] -= e.flow, bal[e.to] += e.flow;
+	}
+	rep(i,0,n) assert(bal[i] == (i == s ? -flow : i == t ? flow : 0));
+}
+
+int main() {
+	rep(it,0,50000) {
+		G g{2 + int(rng() % 8), {}};
+		int n = g.n, s = rng() % n, t = rng() % (n - 1), big = rng() % 2 ? 5 : 1000;
+		if (t >= s) t++;
+		Dinic D(n), S(n);
+		rep(i,0,int(rng() % 30)) {
+			int a = rng() % n, b = rng() % n, c = rng() % big, dir = rng() % 4 > 0;
+			g.ed.push_back({a, b, c, dir});
+			D.AddEdge(a, b, c, dir); S.AddEdge(a, b, c, dir);
+		}
+		T f = D.Compute(s, t);
+		assert(S.Compute(s, t, true) == f && f == fresh(g, s, t));
+		check(S, n, s, t, f);
+		if (g.ed.empty()) continue;
+		rep(k,0,10) {
+			int i = rng() % sz(g.ed), c = rng() % big;
+			g.ed[i][2] = c;
+			f += D.SetCap(2 * i, c, s, t);
+			if (!g.ed[i][3]) f += D.SetCap(2 * i + 1, c, s, t);
+			assert(f == fresh(g, s, t));
+			check(D, n, s, t, f);
+			T cut = 0;
+			for (auto& e : D.es)
+				if (!D.SideOfCut(e.from) && D.SideOfCut(e.to)) cut += e.cap;
+			assert(cut == f);
+		}
+	}
+
+	{ // scaling wins: a wide chain next to many small forward edges
+		int n = 1002;
+		G h{n, {}};
+		rep(i,0,n - 1) h.ed.push_back({i, i + 1, 1 << 29, 1});
+		rep(i,0,20000) {
+			int a = rng() % n, b = rng() % n;
+			h.ed.push_back({min(a, b), max(a, b), int(1 + rng() % 1000), 1});
+		}
+		T r[2];
+		rep(sc,0,2) {
+			Dinic S(n);
+			for (auto [a, b, c, dir] : h.ed) S.AddEdge(a, b, c, dir);
+			timeit tm(sc ? "chain, scaling" : "chain, plain");
+			r[sc] = S.Compute(0, n - 1, sc);
+		}
+		assert(r[0] == r[1]);
+	}
+
+	int n = 20000, m = 200000, s = 0, t = n - 1;
+	G g{n, {}};
+	rep(i,0,m) g.ed.push_back({int(rng() % n), int(rng() % n), int(rng() % 1000000), 1});
+	Dinic D(n);
+	for (auto [a, b, c, dir] : g.ed) D.AddEdge(a, b, c, dir);
+	T f;
+	{
+		timeit tm("scaling");
+		Dinic S = D;
+		f = S.Compute(s, t, true);
+	}
+	{
+		timeit tm("plain");
+		assert(D.Compute(s, t) == f);
+	}
+	{
+		timeit tm("1000 SetCap");
+		rep(k,0,1000) {
+			int i = rng() % m, c = max(0, g.ed[i][2] + int(rng() % 2001) - 1000);
+			g.ed[i][2] = c;
+			f += D.SetCap(2 * i, c, s, t);
+		}
+	}
+	{
+		timeit tm("1 from scratch");
+		assert(f == fresh(g, s, t));
+	}
+	cout<<"Tests passed!"<<endl;
+}
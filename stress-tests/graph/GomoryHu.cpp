@@ -1,48 +1,69 @@
 #include "../utilities/template.h"
-#include "../utilities/utils.h"
+#include "../utilities/bench.h"
 
+#include "../../content/graph/DinicFlow.h"
+#include "../../content/graph/PushRelabel.h"
 #include "../../content/graph/GomoryHu.h"
-#include "../../content/graph/Dinic.h"
 
+mt19937 rng(13);
 
-void test(int N, int mxFlow, int iters) {
-    for (int it = 0; it < iters; it++) {
-        int n = rand()%N+1;
-        vector<array<ll, 3>> edges;
-        for (int i = 0; i < n; i++) {
-            for (int j = i + 1; j < n; j++) {
-                edges.push_back({i, j, rand() % mxFlow});
-            }
-        }
-        auto calc = [&](int s, int t) {
-            Dinic flow(n);
-            for (auto e : edges) {
-                flow.addEdge(e[0], e[1], e[2], e[2]);
-            }
-            return flow.calc(s, t);
-        };
-        vector<Edge> gomoryHuTree = gomoryHu(n, edges);
-        vector<vector<array<int, 2>>> adj(n);
-        for (auto e : gomoryHuTree) {
-            adj[e[0]].push_back({e[1], e[2]});
-            adj[e[1]].push_back({e[0], e[2]});
-        }
-        auto dfs = make_y_combinator([&](auto dfs, int start, int cur, int p, int mn) -> void {
-            if (start != cur) {
-                assert(mn == calc(start, cur));
-            }
-            for (auto i : adj[cur]) {
-                if (i[0] != p)
-                    dfs(start, i[0], cur, min(mn, i[1]));
-            }
-        });
-        dfs(0, 0, -1, 1e9);
-    }
+template<class F> void test(int n, vector<array<int, 3>>& ed, int threads) {
+	F D(n);
+	for (auto [a, b, c] : ed) D.AddEdge(a, b, c, false);
+	auto [par, w] = GomoryHu(D, threads);
+	assert(par[0] == -1);
+	vector<vector<pii>> adj(n);
+	rep(i,1,n) {
+		assert(0 <= par[i] && par[i] < n);
+		adj[i].push_back({par[i], w[i]}); adj[par[i]].push_back({i, w[i]});
+		// the tree edge is a cut: the subtree below i against the rest
+		vi in(n); in[i] = 1;
+		rep(k,0,n) rep(v,0,n) if (!in[v] && par[v] >= 0 && in[par[v]]) in[v] = 1;
+		T c = 0;
+		for (auto [a, b, x] : ed) if (in[a] != in[b]) c += x;
+		assert(c == w[i]);
+	}
+	rep(s,0,n) {
+		vector<T> mn(n, -1); mn[s] = numeric_limits<T>::max();
+		vi st{s};
+		while (sz(st)) {
+			int u = st.back(); st.pop_back();
+			for (auto [v, x] : adj[u]) if (mn[v] < 0) mn[v] = min(mn[u], x), st.push_back(v);
+		}
+		rep(t,0,n) if (t != s) {
+			assert(mn[t] >= 0);
+			Dinic E(n);
+			for (auto [a, b, c] : ed) E.AddEdge(a, b, c, false);
+			assert(E.Compute(s, t) == mn[t]);
+		}
+	}
 }
-signed main() {
-    test(25, 5, 105);
-    test(100, 1000, 5);
-    test(100, 1, 50);
-    test(5, 5, 10000);
-    cout<<"Tests passed!"<<endl;
+
+int main() {
+	rep(it,0,3000) {
+		int n = 1 + rng() % 9, m = rng() % 20, mx = rng() % 2 ? 3 : 100;
+		vector<array<int, 3>> ed;
+		rep(i,0,m) ed.push_back({int(rng() % n), int(rng() % n), int(rng() % mx)});
+		test<Dinic>(n, ed, 1);
+		test<Dinic>(n, ed, int(rng() % 5) - 1);
+		test<PushRelabel>(n, ed, 1 + rng() % 4);
+	}
+
+	int n = 1000, m = 10000;
+	vector<array<int, 3>> ed;
+	rep(i,0,m) ed.push_back({int(rng() % n), int(rng() % n), int(rng() % 1000)});
+	Dinic D(n);
+	for (auto [a, b, c] : ed) D.AddEdge(a, b, c, false);
+	vector<T> w1, w4;
+	{
+		timeit t("GomoryHu n=1000, 1 thread");
+		w1 = GomoryHu(D).second;
+	}
+	{
+		timeit t("GomoryHu n=1000, 4 threads");
+		w4 = GomoryHu(D, 4).second;
+	}
+	sort(all(w1)); sort(all(w4));
+	assert(w1 == w4); // same multiset of cut values
+	cout<<"Tests passed!"<<endl;
 }
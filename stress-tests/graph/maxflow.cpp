@@ -1,103 +1,83 @@
 #include "../utilities/template.h"
+#include "../utilities/bench.h"
 
+#include "../../content/graph/DinicFlow.h"
+#include "../../content/graph/DinicCSR.h"
 #include "../../content/graph/PushRelabel.h"
-#include "../../content/graph/Dinic.h"
-#include "../../content/graph/EdmondsKarp.h"
 
-// Bump allocator, to speed the test up and get rid of malloc performance noise
-static char buf[1 << 23];
-static size_t bufi = sizeof buf;
-void* operator new(size_t s) {
-	assert(s < bufi);
-	return (void*)&buf[bufi -= s];
-}
-void operator delete(void*) {}
-
-int main() {
-	rep(it,0,1000000) {
-		bufi = sizeof buf;
-		int n = 2 + rand() % 10;
-		int s = rand() % n;
-		int t = rand() % (n - 1);
-		if (t >= s) t++;
-		PushRelabel pr(n);
-		Dinic dinic(n);
-		vector<unordered_map<int, int>> ek(n);
+mt19937 rng(7);
 
-		int m = rand() % 40;
-		rep(eit,0,m) {
-			int a = rand() % n;
-			int b = rand() % n;
-			int c = rand() % 4;
-			int d = rand() % 4 == 0 ? rand() % 3 + 1 : 0;
-			pr.addEdge(a, b, c, d);
-			dinic.addEdge(a, b, c, d);
-			ek[a][b] += c;
-			ek[b][a] += d;
+template<class F> void checkFlow(F& D, int n, int s, int t, T flow) {
+	vector<T> bal(n); T cut = 0;
+	for (auto& e : D.es) {
+		assert(e.flow <= e.cap);
+		if (e.flow > 0) bal[e.from] -= e.flow, bal[e.to] += e.flow;
+		if (!D.SideOfCut(e.from) && D.SideOfCut(e.to)) {
+			assert(e.flow == e.cap); cut += e.cap;
 		}
-		auto origEk = ek;
-
-		ll flow = pr.calc(s, t);
-
-		// PushRelabel matches Dinic
-		ll dinicFlow = dinic.calc(s, t);
-		assert(flow == dinicFlow);
-
-		// PushRelabel matches EdmondsKarp
-		ll ekFlow = edmondsKarp(ek, s, t);
-		assert(flow == ekFlow);
-
-		// Conservation of flow for PushRelabel
-		vector<ll> flows(n);
-		rep(i,0,n) for(auto &e: pr.g[i]) if (e.f > 0) {
-			assert(e.c >= 0);
-			flows[i] += e.f;
-			flows[e.dest] -= e.f;
-		}
-		assert(flow == flows[s]);
-		assert(flow == -flows[t]);
-		rep(i,0,n) if (i != s && i != t) assert(flows[i] == 0);
+	}
+	rep(i,0,n) assert(bal[i] == (i == s ? -flow : i == t ? flow : 0));
+	assert(!D.SideOfCut(s) && D.SideOfCut(t) && cut == flow);
+}
 
-		// Conservation of flow for Dinic
-		vector<ll> dinicFlows(n);
-		rep(i,0,n) for(auto &e: dinic.adj[i]) {
-			assert(e.flow() <= e.oc);
-			dinicFlows[i] += e.flow();
-			dinicFlows[e.to] -= e.flow();
-		}
-		assert(flows == dinicFlows);
+void bench(string name, int n, vector<array<int, 3>>& ed, int s, int t) {
+	T r1, r2, r3;
+	{
+		Dinic D(n);
+		for (auto [a, b, c] : ed) D.AddEdge(a, b, c);
+		timeit tm(name + ", Dinic");
+		r1 = D.Compute(s, t);
+	}
+	{
+		DinicCSR D(n);
+		for (auto [a, b, c] : ed) D.AddEdge(a, b, c);
+		timeit tm(name + ", DinicCSR");
+		r2 = D.Compute(s, t);
+	}
+	{
+		PushRelabel P(n);
+		for (auto [a, b, c] : ed) P.AddEdge(a, b, c);
+		timeit tm(name + ", PushRelabel");
+		r3 = P.Compute(s, t);
+	}
+	assert(r1 == r2 && r1 == r3);
+}
 
-		// Conservation of flow for EdmondsKarp
-		vector<ll> ekFlows(n);
-		rep(i,0,n) for(auto &e: origEk[i]) {
-			int nc = ek[i][e.first];
-			assert(nc >= 0);
-			int flow = e.second - nc;
-			if (flow > 0) {
-				ekFlows[i] += flow;
-				ekFlows[e.first] -= flow;
-			}
+int main() {
+	rep(it,0,200000) {
+		int n = 2 + rng() % 10, m = rng() % 40;
+		int s = rng() % n, t = rng() % (n - 1);
+		if (t >= s) t++;
+		Dinic D(n); DinicCSR F(n); PushRelabel P(n);
+		rep(i,0,m) {
+			int a = rng() % n, b = rng() % n, c = rng() % 4, dir = rng() % 4 > 0;
+			if (rng() % 8 == 0) c = 1000;
+			D.AddEdge(a, b, c, dir); F.AddEdge(a, b, c, dir); P.AddEdge(a, b, c, dir);
 		}
-		assert(flows == ekFlows);
+		T f = D.Compute(s, t);
+		assert(F.Compute(s, t) == f);
+		assert(P.Compute(s, t) == f);
+		checkFlow(D, n, s, t, f);
+		checkFlow(P, n, s, t, f);
+		assert(P.Compute(s, t) == 0 && D.Compute(s, t) == 0); // already maximal
+		checkFlow(P, n, s, t, f);
+	}
 
-		// PushRelabel computes a cut
-		ll acrossCut = 0;
-		assert(pr.leftOfMinCut(s));
-		assert(!pr.leftOfMinCut(t));
-		rep(i,0,n) for(auto &e: pr.g[i]) {
-			if (pr.leftOfMinCut(i) && !pr.leftOfMinCut(e.dest)) {
-				assert(e.f >= 0);
-				assert(e.c == 0);
-				acrossCut += e.f;
-			}
-			if (!pr.leftOfMinCut(i) && pr.leftOfMinCut(e.dest)) {
-				assert(e.f <= 0);
-			}
+	{
+		int n = 100000, m = 1000000;
+		vector<array<int, 3>> ed;
+		rep(i,0,m) ed.push_back({int(rng() % n), int(rng() % n), int(rng() % 100000)});
+		bench("sparse random", n, ed, 0, n - 1);
+	}
+	{ // dense bipartite-like: s -> L -> R -> t, a quarter of L x R
+		int k = 1500, n = 2 * k + 2;
+		vector<array<int, 3>> ed;
+		rep(i,0,k) {
+			ed.push_back({n - 2, i, int(rng() % 1000)});
+			ed.push_back({k + i, n - 1, int(rng() % 1000)});
 		}
-
-		// min cut = max flow
-		assert(acrossCut == flow);
+		rep(i,0,k) rep(j,0,k) if (rng() % 4 == 0) ed.push_back({i, k + j, int(rng() % 10)});
+		bench("dense bipartite", n, ed, n - 2, n - 1);
 	}
-
 	cout << "Tests passed!" << endl;
 }
@@ -0,0 +1,35 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../../content/number-theory/ModInt.h"
+#include "../../content/number-theory/BatchInv.h"
+
+int main() {
+	mt19937 rng(3);
+	using M = MInt<998244353>;
+	rep(it,0,2000) {
+		int n = rng() % 30;
+		vector<M> a(n);
+		for (auto& x : a) x = rng() % 4 ? rng() : 0;
+		auto b = a;
+		BatchInv(b);
+		rep(i,0,n) {
+			if (a[i] == 0) assert(b[i] == 0);
+			else assert((a[i] * b[i]).Get() == 1);
+		}
+	}
+	// Also over a small field with the default ModInt
+	vector<ModInt> s(3 * MOD);
+	rep(i,0,sz(s)) s[i] = i;
+	BatchInv(s);
+	rep(i,0,sz(s)) assert(i % MOD == 0 ? s[i] == 0 : (s[i] * i).Get() == 1);
+
+	int n = 1 << 23;
+	vector<M> a(n);
+	for (auto& x : a) x = rng() % 998244352 + 1;
+	auto b = a, c = a;
+	{ timeit t("BatchInv, 2^23"); BatchInv(b); }
+	{ timeit t("inv() each, 2^23"); for (auto& x : c) x = x.inv(); }
+	rep(i,0,n) assert(b[i] == c[i]);
+	cout<<"Tests passed!"<<endl;
+}
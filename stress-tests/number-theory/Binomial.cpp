@@ -0,0 +1,48 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../../content/number-theory/Binomial.h"
+
+int main() {
+	const int P = 998244353;
+	using M = MInt<P>;
+	// Pascal's triangle, queried in random order so that tables grow
+	int N = 600;
+	vector<vector<M>> pas(N, vector<M>(N, 0));
+	rep(n,0,N) rep(k,0,n+1) pas[n][k] = k == 0 || k == n ? M(1) : pas[n-1][k-1] + pas[n-1][k];
+	Binomial<M> B;
+	mt19937 rng(7);
+	rep(it,0,200000) {
+		int n = rng() % N, k = (int)(rng() % (n + 3)) - 1;
+		M want = k < 0 || k > n ? M(0) : pas[n][k];
+		assert(B.C(n, k) == want);
+	}
+	M f = 1;
+	rep(i,1,5000) {
+		f = f * i;
+		assert(B.Fact(i) == f && (B.InvFact(i) * f).Get() == 1);
+		assert((B.Inv(i) * i).Get() == 1);
+	}
+	assert(B.Fact(0) == 1 && B.InvFact(0) == 1);
+	// Default ModInt, small prime: everything below MOD
+	Binomial<> S;
+	rep(n,0,MOD) rep(k,0,n+1) {
+		ll c = 1;
+		rep(j,0,k) c = c * (n - j) / (j + 1);
+		assert(S.C(n, k).Get() == c % MOD);
+	}
+
+	// 10^7 binomials
+	Binomial<M> T; int n = 1 << 22;
+	{ timeit t("Grow 2^22"); T.Grow(n); }
+	M s = 0;
+	{
+		timeit t("10^7 binomials");
+		rep(it,0,10000000) {
+			int a = rng() % n, b = rng() % (a + 1);
+			s = s + T.C(a, b);
+		}
+	}
+	cerr << s.Get() << endl;
+	cout<<"Tests passed!"<<endl;
+}
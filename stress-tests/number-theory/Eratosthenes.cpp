@@ -1,4 +1,5 @@
 #include "../utilities/template.h"
+#include "../utilities/bench.h"
 
 namespace dynamic {
 vi eratosthenes(int LIM) {
@@ -21,18 +22,68 @@ vi eratosthenes(int LIM) {
 }
 }
 #include "../../content/number-theory/FastEratosthenes.h"
-#include "../../content/number-theory/Eratosthenes.h"
+#include "../../content/number-theory/LinearSieve.h"
 
+vector<ull> sieve(ull n, int threads = 1) {
+	vector<vector<ull>> r(threads);
+	PrimeSieve(n, [&](ull p, int t) { r[t].push_back(p); }, threads);
+	vector<ull> all;
+	for (auto& v : r) {
+		rep(i,1,sz(v)) assert(v[i - 1] < v[i]);
+		all.insert(all.end(), all(v));
+	}
+	return all;
+}
 
 int main() {
-	vi pr1 = eratosthenesSieve(LIM);
-	vi pr2 = eratosthenes();
-	assert(pr1 == pr2);
+	vector<ull> small;
+	rep(n,0,2000) {
+		if (n > 1 && all_of(all(small), [&](ull p) { return n % p; }))
+			small.push_back(n);
+		assert(sieve(n) == small);
+	}
+	for (int n : {1 << 17, 30 << 17, 30 << 17 | 7, 10'000'019, 30'000'000}) {
+		vi d = dynamic::eratosthenes(n + 1); // primes < n + 1
+		for (int t : {1, 2, 3, 8}) {
+			vector<ull> a = sieve(n, t);
+			assert(sz(a) == sz(d));
+			rep(i,0,sz(a)) assert(a[i] == (ull)d[i]);
+		}
+	}
 
-	for (int lim=121; lim<1000; lim++) {
-		vi pr = eratosthenesSieve(lim);
-		vi r = dynamic::eratosthenes(lim);
-		assert(pr == r);
+	const int N = 1'000'000;
+	LinearSieve s(N);
+	vi d = dynamic::eratosthenes(N);
+	assert(s.pr == d);
+	rep(i,1,N+1) {
+		int x = i, phi = i, mu = 1, lp = 0;
+		for (int p = 2; p * p <= x; ++p) if (x % p == 0) {
+			if (!lp) lp = p;
+			int e = 0;
+			while (x % p == 0) x /= p, ++e;
+			phi = phi / p * (p - 1); mu = e > 1 ? 0 : -mu;
+		}
+		if (x > 1) lp = lp ? lp : x, phi = phi / x * (x - 1), mu = -mu;
+		if (i > 1) assert(s.lp[i] == lp);
+		assert(s.phi[i] == phi && s.mu[i] == mu);
+	}
+
+	{ // pi(10^10) = 455052511
+		timeit t("PrimeSieve 1e10");
+		ll c = 0;
+		PrimeSieve((ull)1e10, [&](ull, int) { ++c; });
+		assert(c == 455052511);
+	}
+	{
+		timeit t("PrimeSieve 1e9, 4 threads");
+		ll c[4] = {};
+		PrimeSieve((ull)1e9, [&](ull, int t) { ++c[t]; }, 4);
+		assert(c[0] + c[1] + c[2] + c[3] == 50847534);
+	}
+	{
+		timeit t("LinearSieve 1e7");
+		LinearSieve l(10'000'000);
+		assert(sz(l.pr) == 664579);
 	}
 	cout<<"Tests passed!"<<endl;
 }
@@ -0,0 +1,83 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../../content/number-theory/Factor.h"
+#include "../../content/number-theory/FactorFast.h"
+
+mt19937_64 rng(11);
+FastFactor F;
+
+ull randPrime(int bits) {
+	while (true) {
+		ull p = (rng() >> (64 - bits)) | 1ULL << (bits - 1) | 1;
+		if (IsPrime(p)) return p;
+	}
+}
+
+void check(ull n) {
+	auto a = F(n), b = Factor(n);
+	sort(all(a)); sort(all(b));
+	assert(a == b);
+}
+
+int main() {
+	assert(F(1).empty() && F(0).empty());
+	assert(F(2) == vector<ull>{2});
+	rep(n,1,200000) check(n);
+	rep(n,0,200000) assert(FastFactor::IsPrime(n) == IsPrime(n));
+	rep(it,0,20000) { // "MillerRabin.h" needs n < 7e18
+		ull n = rng() % 7000000000000000000ULL;
+		assert(FastFactor::IsPrime(n) == IsPrime(n));
+		assert(FastFactor::IsPrime(n | 1) == IsPrime(n | 1));
+	}
+	// Strong pseudoprimes to several bases, Carmichael numbers
+	for (ull n : {3215031751ULL, 2152302898747ULL, 3474749660383ULL,
+			341550071728321ULL, 3825123056546413051ULL, 561ULL, 41041ULL})
+		assert(FastFactor::IsPrime(n) == IsPrime(n));
+	rep(it,0,3000) check(rng() % 7000000000000000000ULL);
+	rep(it,0,300) {
+		// Semiprimes, prime powers, products of small and large primes
+		int b = rng() % 30 + 2;
+		ull p = randPrime(b), q = randPrime(62 - b);
+		check(p * q);
+		ull r = randPrime(31); check(r * r);
+		ull s = randPrime(20); check(s * s * s);
+		check(randPrime(62));
+		ull t = 1; while (t < (1ULL << 40)) t *= randPrime(rng() % 12 + 2);
+		check(t);
+	}
+	// Batch
+	vector<ull> a(1000);
+	for (auto& x : a) x = rng() >> (rng() % 40 + 1);
+	vector<ull> f; vi at;
+	F.Batch(a, f, at);
+	assert(sz(at) == sz(a) + 1 && at.back() == sz(f));
+	rep(i,0,sz(a)) {
+		vector<ull> x(f.begin() + at[i], f.begin() + at[i + 1]), y = Factor(a[i]);
+		sort(all(x)); sort(all(y));
+		assert(x == y);
+	}
+
+	// 10^4 random 60-bit semiprimes with balanced factors
+	vector<ull> v(10000);
+	for (auto& x : v) x = randPrime(30) * randPrime(30);
+	ull h1 = 0, h2 = 0;
+	{
+		timeit t("FastFactor, 10^4 semiprimes");
+		F.Batch(v, f, at);
+		for (ull x : f) h1 += x;
+	}
+	{
+		timeit t("Factor, 10^4 semiprimes");
+		for (ull x : v) for (ull y : Factor(x)) h2 += y;
+	}
+	assert(h1 == h2);
+	// 10^5 random 60-bit numbers
+	vector<ull> w(100000);
+	for (auto& x : w) x = rng() >> 4;
+	{
+		timeit t("FastFactor, 10^5 random");
+		F.Batch(w, f, at);
+	}
+	cout<<"Tests passed!"<<endl;
+}
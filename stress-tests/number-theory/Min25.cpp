@@ -0,0 +1,75 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../../content/number-theory/LinearSieve.h"
+#include "../../content/number-theory/Min25.h"
+namespace ignore {
+#include "../../content/number-theory/ModInt.h"
+}
+using ignore::MInt; using Mod = MInt<998244353>;
+
+typedef __int128 L;
+
+int main() {
+	const int N = 200'000;
+	LinearSieve ls(N);
+	vector<ll> pi(N + 1), ps(N + 1), phi(N + 1), mu(N + 1), d(N + 1);
+	vi dc(N + 1, 0);
+	rep(i,1,N+1) for (int j = i; j <= N; j += i) dc[j]++;
+	rep(i,1,N+1) {
+		bool p = ls.lp[i] == i;
+		pi[i] = pi[i - 1] + p; ps[i] = ps[i - 1] + (p ? i : 0);
+		phi[i] = phi[i - 1] + ls.phi[i]; mu[i] = mu[i - 1] + ls.mu[i];
+		d[i] = d[i - 1] + dc[i];
+	}
+	auto fphi = [](ll p, int /*e*/, ll pe) { return L(pe / p * (p - 1)); };
+	auto fmu = [](ll, int e, ll) { return e > 1 ? 0LL : -1LL; };
+	auto fd = [](ll, int e, ll) { return ll(e + 1); };
+	auto pre0 = [](ll v) { return v - 1; };
+	auto pre1 = [](ll v) { return L(v) * (v + 1) / 2 - 1; };
+	auto g0 = [](ll) { return 1LL; };
+	auto g1 = [](ll p) { return L(p); };
+	vector<ll> ns;
+	rep(n,1,300) ns.push_back(n);
+	mt19937 rng(3);
+	rep(it,0,200) ns.push_back(rng() % N + 1);
+	ns.push_back(N);
+	for (ll n : ns) {
+		Min25 m(n);
+		auto c = m.Lucy<ll>(pre0, g0);
+		auto s = m.Lucy<L>(pre1, g1);
+		for (ll k = 1; k <= n; k = n / (n / k) + 1) {
+			ll v = n / k;
+			assert(c[m.id(v)] == pi[v] && s[m.id(v)] == ps[v]);
+		}
+		vector<L> fp(sz(c)); vector<ll> fm(sz(c)), fdv(sz(c));
+		rep(i,0,sz(c)) fp[i] = s[i] - c[i], fm[i] = -c[i], fdv[i] = 2 * c[i];
+		assert(m.Sum(fp, fphi) == phi[n]);
+		assert(m.Sum(fm, fmu) == mu[n]);
+		assert(m.Sum(fdv, fd) == d[n]);
+		auto sm = m.Lucy<Mod>([](ll v) { return Mod(L(v) * (v + 1) / 2 % 998244353) - 1; },
+			[](ll p) { return Mod(p); });
+		assert(sm[0] == Mod(ps[n] % 998244353));
+	}
+
+	ll n = 100'000'000'000;
+	Min25 m(n);
+	vector<ll> c;
+	{
+		timeit t("Lucy pi(1e11)");
+		c = m.Lucy<ll>(pre0, g0);
+	}
+	assert(c[0] == 4118054813LL);
+	{
+		timeit t("Lucy sum of primes 1e11, __int128");
+		auto s = m.Lucy<L>(pre1, g1);
+		assert(s[0] == (L)201467077743LL * 1'000'000'000 + 744681014);
+	}
+	{
+		timeit t("Mertens(1e11)");
+		vector<ll> fm(sz(c));
+		rep(i,0,sz(c)) fm[i] = -c[i];
+		assert(m.Sum(fm, fmu) == -87856);
+	}
+	cout<<"Tests passed!"<<endl;
+}
@@ -0,0 +1,102 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../../content/number-theory/ModInt.h"
+#include "../../content/numerical/PolyMul.h"
+
+typedef unsigned long long ull;
+ull mulmod(ull a, ull b, ull m) { return (__uint128_t)a * b % m; }
+ull powmod(ull b, ull e, ull m) {
+	ull r = 1;
+	for (; e; e /= 2, b = mulmod(b, b, m)) if (e & 1) r = mulmod(r, b, m);
+	return r;
+}
+
+// Checks all operations of T (modulo m) against plain % arithmetic
+template<class T> void check(ull m, mt19937_64& rng) {
+	auto rnd = [&]() -> ll {
+		switch (rng() % 4) {
+			case 0: return rng() % 5;
+			case 1: return (ll)(m - 1 - rng() % 5);
+			case 2: return -(ll)(rng() % (2 * m) % LLONG_MAX);
+			default: return (ll)(rng() >> 1);
+		}
+	};
+	auto norm = [&](ll v) { ll r = v % (ll)m; return ull(r < 0 ? r + m : r); };
+	rep(it,0,20000) {
+		ll a = rnd(), b = rnd();
+		ull x = norm(a), y = norm(b);
+		T ta = a, tb = b;
+		assert(ta.Get() == x && tb.Get() == y);
+		assert((ta + tb).Get() == (x + y) % m);
+		assert((ta - tb).Get() == (x + m - y) % m);
+		assert((ta * tb).Get() == mulmod(x, y, m));
+		assert((ta == tb) == (x == y));
+		ull e = rng() % 1000;
+		assert(ta.pow(e).Get() == powmod(x, e, m));
+		if (y) {
+			assert((tb * tb.inv()).Get() == 1);
+			assert((ta / tb * tb).Get() == x);
+		}
+	}
+}
+
+template<class T> vector<T> naive(vector<T> a, vector<T> b) {
+	vector<T> c(sz(a) + sz(b) - 1, 0);
+	rep(i,0,sz(a)) rep(j,0,sz(b)) c[i + j] = c[i + j] + a[i] * b[j];
+	return c;
+}
+template<class T> void checkMul(mt19937_64& rng) {
+	rep(it,0,200) {
+		vector<T> a(rng() % 100 + 1), b(rng() % 100 + 1);
+		for (auto& x : a) x = (ll)(rng() >> 1);
+		for (auto& x : b) x = (ll)(rng() >> 1);
+		auto c = Mul(a, b), d = naive(a, b);
+		assert(sz(c) == sz(d));
+		rep(i,0,sz(c)) assert(c[i] == d[i]);
+	}
+}
+
+int main() {
+	mt19937_64 rng(5);
+	check<ModInt>(MOD, rng);
+	check<MInt<3>>(3, rng);
+	check<MInt<998244353>>(998244353, rng);
+	check<MInt<1000000007>>(1000000007, rng);
+	check<MInt<2147483647>>(2147483647, rng);
+	check<MInt64<(5ULL << 55) + 1>>((5ULL << 55) + 1, rng);
+	check<MInt64<1000000000000000003ULL>>(1000000000000000003ULL, rng);
+	check<MInt64<(1ULL << 63) - 25>>((1ULL << 63) - 25, rng);
+	for (ull m : {3ULL, 17ULL, 1000000007ULL, 2147483629ULL}) {
+		DynMInt::Set((uint32_t)m);
+		check<DynMInt>(m, rng);
+	}
+	static_assert(MInt<998244353>::IV * 998244353u == 1, "");
+
+	// Several NTT primes in one program, each with its own roots
+	checkMul<MInt<998244353>>(rng);
+	checkMul<MInt<167772161>>(rng);
+	checkMul<MInt<469762049>>(rng);
+	checkMul<MInt64<(5ULL << 55) + 1>>(rng);
+
+	// Element-wise products: % by a constant, by a runtime modulus, Montgomery
+	const int P = 998244353, N = 1 << 22;
+	volatile int vp = P; int p = vp;
+	vector<int> a(N), b(N), c(N);
+	for (auto& x : a) x = rng() % P;
+	for (auto& x : b) x = rng() % P;
+	auto bench = [&](string label, auto f) {
+		timeit t(label);
+		rep(r,0,8) f();
+	};
+	bench("% constant", [&] { rep(i,0,N) c[i] = int((ll)a[i] * b[i] % P); });
+	bench("% runtime", [&] { rep(i,0,N) c[i] = int((ll)a[i] * b[i] % p); });
+	vector<MInt<P>> ma(all(a)), mb(all(b)), mc(N);
+	bench("MInt<P>", [&] { rep(i,0,N) mc[i] = ma[i] * mb[i]; });
+	rep(i,0,N) assert(mc[i].Get() == (uint32_t)c[i]);
+	DynMInt::Set(p);
+	vector<DynMInt> da(all(a)), db(all(b)), dc(N);
+	bench("DynMInt", [&] { rep(i,0,N) dc[i] = da[i] * db[i]; });
+	rep(i,0,N) assert(dc[i].Get() == (uint32_t)c[i]);
+	cout<<"Tests passed!"<<endl;
+}
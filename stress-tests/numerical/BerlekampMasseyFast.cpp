@@ -0,0 +1,65 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../utilities/modint.h"
+const int MOD = 998244353;
+using ModInt = MInt<MOD>;
+#include "../../content/numerical/BerlekampMasseyFast.h"
+
+typedef vector<ModInt> poly;
+
+// Random sequence of order l, first z terms zero and the rest random
+poly gen(int n, int l, int z) {
+	poly c(l), s(n, 0);
+	for (auto& x : c) x = rand() % MOD;
+	rep(i,0,n) {
+		if (i < l) s[i] = i < z ? 0 : rand() % MOD;
+		else rep(j,0,l) s[i] = s[i] + c[j] * s[i - 1 - j];
+	}
+	return s;
+}
+
+void check(poly s) {
+	int n = sz(s);
+	poly a = BerlekampMassey(s), b = BerlekampMasseyFast(s);
+	assert(sz(a) == sz(b));
+	if (2 * sz(b) <= n) assert(a == b);
+	rep(i,sz(b),n) {
+		ModInt x = 0;
+		rep(j,0,sz(b)) x = x + b[j] * s[i - 1 - j];
+		assert(x == s[i]);
+	}
+}
+
+int main() {
+	rep(it,0,50) {
+		int n = 1501 + rand() % 1000;
+		int l = rand() % 3 == 0 ? n / 2 + rand() % (n / 2) : rand() % (n / 2 + 1);
+		int z = rand() % 3 ? 0 : rand() % (l + 1);
+		check(gen(n, l, z));
+	}
+	check(poly(2500, 0));
+	{
+		poly s(3000, 0); s[2999] = 1;
+		check(s);
+	}
+
+	int n = 200000;
+	poly s = gen(n, n / 2, 0), b;
+	{
+		timeit t("fast n=200000");
+		b = BerlekampMasseyFast(s);
+	}
+	assert(sz(b) == n / 2);
+	poly q(20000);
+	for (auto& x : q) x = rand() % MOD;
+	{
+		timeit t("fast n=20000");
+		BerlekampMasseyFast(q);
+	}
+	{
+		timeit t("old n=20000");
+		BerlekampMassey(q);
+	}
+	cout<<"Tests passed!"<<endl;
+}
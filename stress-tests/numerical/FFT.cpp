@@ -0,0 +1,98 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../../content/numerical/FFT.h"
+
+namespace old {
+void DFT(vector<complex<double>> &a, bool rev) {
+	int n = a.size(); auto b = a;
+	for (int step = n / 2; step; step /= 2) {
+		for (int i = 0; i < n / 2; i += step) {
+			auto wn = polar(1.0, 2.0 * M_PI * (rev ? -i : i) / n);
+			for (int j = 0; j < step; ++j) {
+				auto u = a[i * 2 + j], v = wn * a[i * 2 + j + step];
+				b[i + j] = u + v; b[i + n / 2 + j] = u - v;
+			}
+		}
+		swap(a, b);
+	}
+	if (rev) for (auto& x : a) x /= n;
+}
+vector<double> Conv(const vector<double>& a, const vector<double>& b) {
+	int m = sz(a) + sz(b) - 1, n = 1;
+	while (n < m) n *= 2;
+	vector<C> fa(all(a)), fb(all(b));
+	fa.resize(n), fb.resize(n);
+	DFT(fa, 0), DFT(fb, 0);
+	rep(i,0,n) fa[i] *= fb[i];
+	DFT(fa, 1);
+	vector<double> res(m);
+	rep(i,0,m) res[i] = fa[i].real();
+	return res;
+}
+}
+
+int main() {
+	rep(lg,0,10) {
+		int n = 1 << lg;
+		vector<C> a(n);
+		for (auto& x : a) x = C(rand() % 10 - 5, rand() % 10 - 5);
+		auto b = a, c = a;
+		DFT(b, 0); old::DFT(c, 0);
+		rep(i,0,n) assert(abs(b[i] - c[i]) < 1e-6);
+		DFT(b, 1);
+		rep(i,0,n) assert(abs(b[i] - a[i]) < 1e-9);
+	}
+	rep(it,0,1000) {
+		vector<double> a(rand() % 50 + 1), b(rand() % 50 + 1);
+		for (auto& x : a) x = rand() % 2000 - 1000;
+		for (auto& x : b) x = rand() % 2000 - 1000;
+		auto c = Conv(a, b);
+		assert(sz(c) == sz(a) + sz(b) - 1);
+		rep(i,0,sz(c)) {
+			double s = 0;
+			rep(j,0,sz(a)) if (i - j >= 0 && i - j < sz(b)) s += a[j] * b[i - j];
+			assert(abs(s - c[i]) < 1e-6);
+		}
+	}
+	const ll M = 1e9 + 7;
+	rep(it,0,300) {
+		vector<ll> a(rand() % 100 + 1), b(rand() % 100 + 1);
+		for (auto& x : a) x = it % 2 ? M - 1 : rand() % M;
+		for (auto& x : b) x = it % 2 ? M - 1 : rand() % M;
+		auto c = ConvMod(a, b, M);
+		rep(i,0,sz(c)) {
+			ll s = 0;
+			rep(j,0,sz(a)) if (i - j >= 0 && i - j < sz(b)) s = (s + a[j] * b[i - j]) % M;
+			assert(s == c[i]);
+		}
+	}
+	{ // large exact check against a sparse direct sum
+		int n = 1 << 19;
+		vector<ll> a(n), b(n);
+		for (auto& x : a) x = M - 1 - rand() % 1000;
+		for (auto& x : b) x = M - 1 - rand() % 1000;
+		auto c = ConvMod(a, b, M);
+		rep(it,0,20) {
+			int i = rand() % sz(c); ll s = 0;
+			rep(j,0,n) if (i - j >= 0 && i - j < n) s = (s + a[j] * b[i - j]) % M;
+			assert(s == c[i]);
+		}
+	}
+
+	rep(lg,10,21) {
+		int n = 1 << (lg - 1), its = max(1, (1 << 18) / n);
+		vector<double> a(n), b(n), c, d;
+		for (auto& x : a) x = rand() % 100;
+		for (auto& x : b) x = rand() % 100;
+		ll t0 = tick();
+		rep(it,0,its) c = old::Conv(a, b);
+		ll t1 = tick();
+		rep(it,0,its) d = Conv(a, b);
+		ll t2 = tick();
+		rep(i,0,sz(c)) assert(abs(c[i] - d[i]) < 1e-3 * max(1.0, abs(c[i])));
+		cout << "n = 2^" << lg << ": complex conv " << (t1 - t0) / its / 1000
+			<< "us, packed real conv " << (t2 - t1) / its / 1000 << "us" << endl;
+	}
+	cout<<"Tests passed!"<<endl;
+}
@@ -0,0 +1,89 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+// Compile with -mavx2 to test the vectorized butterflies.
+#include "../../content/numerical/FST.h"
+
+#include "../utilities/modint.h"
+using Mi = MInt<998244353>;
+
+namespace old {
+void DFT(vector<int>& a, bool rev) {
+	int n = sz(a);
+	for (int step = 1; step < n; step *= 2)
+	for (int i = 0; i < n; i += 2 * step)
+	for (int j = i; j < i + step; ++j) {
+		int u = a[j], v = a[j + step];
+		tie(a[j], a[j + step]) = make_pair(u + v, u - v);
+	}
+	if (rev) for (auto& x : a) x /= n;
+}
+}
+
+int op(int k, int i, int j) { return k == AND ? i & j : k == OR ? i | j : i ^ j; }
+
+template<int K, class T> void test(int lg, int threads) {
+	int n = 1 << lg;
+	vector<T> a(n), b(n), c(n), want(n);
+	for (auto& x : a) x = T(rand() % 11 - 5);
+	for (auto& x : b) x = T(rand() % 11 - 5);
+	if (lg <= 10) rep(i,0,n) rep(j,0,n) {
+		auto& w = want[op(K, i, j)]; w = w + a[i] * b[j];
+	}
+	auto a0 = a;
+	FST<K>(a, 0, threads); FST<K>(b, 0, threads);
+	rep(i,0,n) c[i] = a[i] * b[i];
+	FST<K>(c, 1, threads); FST<K>(a, 1, threads);
+	assert(a == a0);
+	if (lg <= 10) assert(c == want);
+}
+
+template<int K> void testAll() {
+	rep(lg,0,11) rep(t,1,4) {
+		test<K, int>(lg, t); if (K != XOR) test<K, unsigned>(lg, t);
+		test<K, ll>(lg, t); test<K, double>(lg, t); test<K, Mi>(lg, t);
+	}
+	// run (vectorized if possible) against bf, on all of [0, P)
+	rep(len,0,40) rep(rev,0,2) rep(it,0,20) {
+		uint32_t P = Mi::mod();
+		vector<Mi> a(len), b(len);
+		for (auto* v : {&a, &b}) for (auto& x : *v)
+			x.x = rand() % 3 ? rand() % P : rand() % 2 ? 0 : P - 1;
+		auto c = a, d = b;
+		FastSubsetTransform<K, Mi>::run(a.data(), b.data(), len, rev);
+		rep(i,0,len) FastSubsetTransform<K, Mi>::bf(c[i], d[i], rev);
+		assert(a == c && b == d);
+	}
+	for (int lg : {12, 13, 20, 21}) test<K, int>(lg, lg % 2 ? 4 : 1);
+}
+
+int main() {
+	testAll<AND>(); testAll<OR>(); testAll<XOR>();
+	rep(lg,0,21) {
+		vector<int> a(1 << lg), b;
+		for (auto& x : a) x = rand();
+		b = a;
+		old::DFT(a, 0); FST<XOR>(b, 0);
+		assert(a == b);
+	}
+
+	for (int lg : {16, 20, 24}) {
+		vector<int> a(1 << lg);
+		for (auto& x : a) x = rand();
+		auto b = a, c = a;
+		auto best = [&](function<void()> f) {
+			ll r = LLONG_MAX;
+			rep(it,0,5) { ll t = tick(); f(); r = min(r, tick() - t); }
+			return r / 1000000.0;
+		};
+		double t0 = best([&] { old::DFT(a, 0); });
+		double t1 = best([&] { FST<XOR>(b, 0); });
+		double t2 = best([&] { FST<XOR>(c, 0, 4); });
+		vector<Mi> m(all(a));
+		double t3 = best([&] { FST<XOR>(m, 0); });
+		printf("2^%d: old %.2fms, new %.2fms, new 4 threads %.2fms, MInt %.2fms\n",
+			lg, t0, t1, t2, t3);
+		assert(a == b && b == c);
+	}
+	cout<<"Tests passed!"<<endl;
+}
@@ -0,0 +1,54 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+// Compile with -mavx2 to test the vectorized kernel.
+#include "../../content/numerical/FastNTT.h"
+
+#include "../utilities/modint.h"
+const int MOD = 998244353;
+using ModInt = MInt<MOD>;
+#include "../../content/numerical/PolyMul.h"
+
+template<uint32_t P> vector<uint32_t> naive(const vector<uint32_t>& a, const vector<uint32_t>& b) {
+	if (a.empty() || b.empty()) return {};
+	vector<uint32_t> c(sz(a) + sz(b) - 1);
+	rep(i,0,sz(a)) rep(j,0,sz(b))
+		c[i + j] = (uint32_t)((c[i + j] + (uint64_t)a[i] * b[j]) % P);
+	return c;
+}
+
+template<uint32_t P> void test() {
+	FastNTT<P> ntt;
+	rep(it,0,2000) {
+		vector<uint32_t> a(rand() % 70), b(rand() % 70);
+		for (auto& x : a) x = rand() % P;
+		for (auto& x : b) x = it % 3 ? rand() % P : P - 1;
+		assert(ntt.Mul(a, b) == naive<P>(a, b));
+	}
+}
+
+int main() {
+	test<998244353>();
+	test<469762049>();
+	test<167772161>();
+	test<7340033>();
+
+	FastNTT<998244353> ntt;
+	rep(lg,10,24) {
+		int n = 1 << (lg - 1), its = max(1, (1 << 20) / n);
+		vector<uint32_t> a(n), b(n);
+		for (auto& x : a) x = rand() % MOD;
+		for (auto& x : b) x = rand() % MOD;
+		vector<ModInt> ma(all(a)), mb(all(b)), mc;
+		vector<uint32_t> c;
+		ll t0 = tick();
+		rep(it,0,its) mc = Mul(ma, mb);
+		ll t1 = tick();
+		rep(it,0,its) c = ntt.Mul(a, b);
+		ll t2 = tick();
+		rep(i,0,sz(c)) assert(c[i] == mc[i].Get());
+		cout << "n = 2^" << lg << ": NTT.h " << (t1 - t0) / its / 1000
+			<< "us, FastNTT.h " << (t2 - t1) / its / 1000 << "us" << endl;
+	}
+	cout<<"Tests passed!"<<endl;
+}
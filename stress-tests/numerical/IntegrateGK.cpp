@@ -0,0 +1,83 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+namespace simple {
+#include "../../content/numerical/Integrate.h"
+}
+namespace adaptive {
+#include "../../content/numerical/IntegrateAdaptive.h"
+}
+#include "../../content/numerical/IntegrateGK.h"
+
+template<class G> auto batch(G g, int& cnt) {
+	return [g, &cnt](const double* x, double* y, int k) {
+		cnt += k;
+		rep(i,0,k) y[i] = g(x[i]);
+	};
+}
+
+int main() {
+	// Batch Simpson is the scalar one
+	rep(it,0,100) {
+		double a = rand() % 10 - 5, b = a + rand() % 5 + 1, p = rand() % 7;
+		auto g = [&](double x) { return cos(p * x) + x * x; };
+		int cnt = 0;
+		double v1 = simple::Quad(g, a, b), v2 = simple::QuadBatch(batch(g, cnt), a, b);
+		assert(abs(v1 - v2) < 1e-9 * max(1.0, abs(v1)));
+		assert(cnt == 2001);
+		assert(abs(adaptive::Quad(g, a, b) - v1) < 1e-6);
+	}
+
+	// Known integrals, single and multi threaded
+	struct T { function<double(double)> g; double a, b, want; };
+	vector<T> tests = {
+		{[](double x) { return sin(x); }, 0, M_PI, 2},
+		{[](double x) { return exp(x); }, 0, 3, exp(3) - 1},
+		{[](double x) { return 1 / sqrt(x); }, 0, 1, 2},
+		{[](double x) { return log(x); }, 0, 1, -1},
+		{[](double x) { return 1 / (1 + 25 * x * x); }, -1, 1, 0.4 * atan(5)},
+		{[](double x) { return abs(x - 0.3); }, 0, 1, 0.29},
+		{[](double x) { return x < 0.7; }, 0, 1, 0.7},
+		{[](double x) { return sin(100 * x); }, 0, M_PI, 0},
+		{[](double x) { return pow(x, 7) - 3 * x; }, -2, 1, -255. / 8 + 4.5},
+	};
+	for (auto& t : tests) for (int th : {1, 3}) {
+		int cnt = 0;
+		double v = QuadGK(batch(t.g, cnt), t.a, t.b, 1e-10, th, 1 << 14);
+		double tol = t.g(0.7) == 1 ? 1e-4 : 1e-8; // discontinuity
+		assert(abs(v - t.want) < tol);
+	}
+	// Polynomials of degree <= 22 are exact with one interval
+	rep(it,0,100) {
+		vector<double> p(23);
+		for (auto& c : p) c = rand() % 21 - 10;
+		auto g = [&](double x) { double r = 0; for (int i = 22; i >= 0; --i) r = r * x + p[i]; return r; };
+		double want = 0, a = -1, b = 1.5;
+		rep(i,0,23) want += p[i] * (pow(b, i + 1) - pow(a, i + 1)) / (i + 1);
+		int cnt = 0;
+		double v = QuadGK(batch(g, cnt), a, b, 1e-7 * max(1.0, abs(want)));
+		assert(abs(v - want) < 1e-6 * max(1.0, abs(want)));
+	}
+
+	// Benchmark: many integrals of a peaked function
+	double s = 0; int cnt = 0;
+	{
+		timeit t("QuadGK, 10000 integrals");
+		rep(i,0,10000) {
+			double c = i / 10000.;
+			s += QuadGK(batch([c](double x) { return exp(-100 * (x - c) * (x - c)); }, cnt), 0, 1);
+		}
+	}
+	cerr << cnt / 10000. << " evaluations per integral" << endl;
+	{
+		int cnt2 = 0; double s2 = 0;
+		timeit t("adaptive Simpson, 10000 integrals");
+		rep(i,0,10000) {
+			double c = i / 10000.;
+			s2 += adaptive::Quad([c, &cnt2](double x) { ++cnt2; return exp(-100 * (x - c) * (x - c)); }, 0, 1);
+		}
+		cerr << cnt2 / 10000. << " evaluations per integral" << endl;
+		assert(abs(s - s2) < 1e-3);
+	}
+	cout<<"Tests passed!"<<endl;
+}
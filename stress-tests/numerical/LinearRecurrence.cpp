@@ -1,42 +1,72 @@
 #include "../utilities/template.h"
+#include "../utilities/bench.h"
 
+#include "../utilities/modint.h"
+const int MOD = 998244353;
+using ModInt = MInt<MOD>;
 #include "../../content/numerical/LinearRecurrence.h"
 
-template<class F>
-void gen(vector<ll>& v, int at, F f) {
-	if (at == sz(v)) f();
-	else {
-		rep(i,0,mod) {
-			v[at] = i;
-			gen(v, at+1, f);
-		}
+using Poly = vector<ModInt>;
+
+namespace old {
+ModInt LinearRec(Poly first, Poly trans, ll k) {
+	int n = trans.size();
+	Poly r(n + 1, 0), b(r); r[0] = b[1] = 1;
+	auto ans = b[0];
+	auto combine = [&](Poly a, Poly b) {
+		Poly res(n * 2 + 1, 0);
+		rep(i,0,n+1) rep(j,0,n+1) res[i + j] = res[i + j] + a[i] * b[j];
+		for (int i = 2 * n; i > n; --i)
+			rep(j,0,n) res[i - 1 - j] = res[i - 1 - j] + res[i] * trans[j];
+		res.resize(n + 1);
+		return res;
+	};
+	for (++k; k; k /= 2) {
+		if (k % 2) r = combine(r, b);
+		b = combine(b, b);
 	}
+	rep(i,0,n) ans = ans + r[i + 1] * first[i];
+	return ans;
+}
 }
 
 int main() {
-	rep(n,1,5) {
-		vector<ll> start(n);
-		vector<ll> coef(n);
-		int size = 10*n + 3;
-		vector<ll> full(size);
-		gen(start,0,[&]() {
-			gen(coef,0,[&]() {
-				for(auto &x:full) x = 0;
-				rep(i,0,n) full[i] = start[i];
-				rep(i,n,size) rep(j,0,n) full[i] = (full[i] + coef[j] * full[i-1 - j]) % mod;
-	// rep(i,0,size) cerr << full[i] << ' '; cerr << endl;
-	// rep(i,0,n) cerr << coef[i] << ' '; cerr << endl;
-	// LinearRec lr(start, coef);
-	// rep(i,0,size) { cerr << lr.Get(i) << ' '; } cerr << endl;
-				rep(i,0,size) {
-					auto v = linearRec(start, coef, i);
-	// cerr << v << ' ';
-					assert(v == full[i]);
-				}
-	// cerr << endl;
-	// cerr << endl;
-			});
-		});
+	rep(n,0,40) rep(it,0,5) {
+		Poly start = randVec<ModInt>(n), coef = randVec<ModInt>(n);
+		if (it == 0) for (auto& x : coef) x = rand() % 2;
+		int size = 10 * n + 3;
+		Poly full(size, 0);
+		rep(i,0,min(n, size)) full[i] = start[i];
+		rep(i,n,size) rep(j,0,n) full[i] = full[i] + coef[j] * full[i - 1 - j];
+		LinRec lr(start, coef);
+		rep(i,0,size) {
+			assert(lr.Get(i) == full[i]);
+			assert(LinearRec(start, coef, i) == full[i]);
+		}
+		rep(j,0,3) {
+			ll k = rand() * (ll)rand() % (ll)1e15;
+			assert(lr.Get(k) == old::LinearRec(start, coef, k));
+		}
+	}
+	assert(LinearRec({0, 1}, {1, 1}, 10).Get() == 55);
+
+	for (int n : {500, 10000}) {
+		Poly start = randVec<ModInt>(n), coef = randVec<ModInt>(n);
+		ll k = (ll)1e18; ModInt r;
+		if (n <= 500) {
+			timeit t("old n=" + to_string(n));
+			r = old::LinearRec(start, coef, k);
+		}
+		{
+			timeit t("single n=" + to_string(n));
+			ModInt s = LinearRec(start, coef, k);
+			if (n <= 500) assert(s == r);
+		}
+		LinRec lr(start, coef); lr.Get(k);
+		{
+			timeit t("cached x10 n=" + to_string(n));
+			rep(i,0,10) lr.Get(k - i);
+		}
 	}
 	cout<<"Tests passed!"<<endl;
 }
@@ -0,0 +1,78 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../utilities/modint.h"
+const int MOD = 998244353;
+using ModInt = MInt<MOD>;
+
+#include "../../content/numerical/NTT.h"
+
+namespace old {
+void DFT(vector<ModInt> &a, bool rev) {
+	int n = a.size(); auto b = a;
+	ModInt g = 1; while (g.pow((MOD - 1) / 2) == 1) g = g + 1;
+	if (rev) g = g.inv();
+	for (int step = n / 2; step; step /= 2) {
+		ModInt w = g.pow((MOD - 1) / (n / step)), wn = 1;
+		for (int i = 0; i < n / 2; i += step) {
+			for (int j = 0; j < step; ++j) {
+				auto u = a[2 * i + j], v = wn * a[2 * i + j + step];
+				b[i + j] = u + v; b[i + n / 2 + j] = u - v;
+			}
+			wn = wn * w;
+		}
+		swap(a, b);
+	}
+	if (rev) {
+		auto n1 = ModInt(n).inv();
+		for (auto& x : a) x = x * n1;
+	}
+}
+}
+
+int main() {
+	rep(lg,0,13) rep(it,0,20) {
+		int n = 1 << lg;
+		auto a = randVec<ModInt>(n), b = a, c = a;
+		DFT(b, 0); old::DFT(c, 0);
+		rep(i,0,n) assert(b[i] == c[i]);
+		DFT(b, 1); old::DFT(c, 1);
+		rep(i,0,n) assert(b[i] == a[i] && c[i] == a[i]);
+	}
+	// raw butterflies with a runtime modulus, generic ones for MInt64
+	DynMInt::Set(MOD);
+	using M64 = MInt64<(5ULL << 55) + 1>;
+	rep(lg,0,13) rep(it,0,5) {
+		int n = 1 << lg;
+		auto a = randVec<ModInt>(n);
+		vector<DynMInt> d(n); vector<M64> e(n);
+		rep(i,0,n) d[i] = a[i].Get(), e[i] = a[i].Get();
+		DFT(a, 0); DFT(d, 0);
+		rep(i,0,n) assert(a[i].Get() == d[i].Get());
+		auto f = e; DFT(f, 0); DFT(f, 1);
+		rep(i,0,n) assert(f[i] == e[i]);
+	}
+	// roots are rebuilt when the runtime modulus changes
+	for (uint32_t P : {469762049u, 998244353u, 167772161u}) {
+		DynMInt::Set(P);
+		vector<DynMInt> d(64); vector<MInt<469762049>> a(64);
+		vector<MInt<167772161>> c(64); vector<ModInt> b(64);
+		rep(i,0,64) { int v = rand(); a[i] = v, b[i] = v, c[i] = v, d[i] = v; }
+		DFT(d, 0); DFT(a, 0); DFT(b, 0); DFT(c, 0);
+		rep(i,0,64) assert(d[i].Get() == (P == 469762049 ? a[i].Get() :
+			P == 998244353 ? b[i].Get() : c[i].Get()));
+	}
+	rep(lg,10,24) {
+		int n = 1 << lg, its = max(1, (1 << 20) / n);
+		auto a = randVec<ModInt>(n), b = a;
+		ll t0 = tick();
+		rep(it,0,its) old::DFT(a, it % 2);
+		ll t1 = tick();
+		rep(it,0,its) DFT(b, it % 2);
+		ll t2 = tick();
+		rep(i,0,n) assert(a[i] == b[i]);
+		cout << "n = 2^" << lg << ": old " << (t1 - t0) / its / 1000 << "us, new "
+			<< (t2 - t1) / its / 1000 << "us" << endl;
+	}
+	cout<<"Tests passed!"<<endl;
+}
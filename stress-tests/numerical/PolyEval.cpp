@@ -0,0 +1,56 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../utilities/modint.h"
+const int MOD = 998244353;
+using ModInt = MInt<MOD>;
+#include "../../content/numerical/PolyEval.h"
+
+typedef vector<ModInt> poly;
+
+ModInt horner(poly p, ModInt x) {
+	ModInt r = 0;
+	for (int i = sz(p) - 1; i >= 0; --i) r = r * x + p[i];
+	return r;
+}
+int main() {
+	rep(it,0,400) {
+		int n = rand() % 150 + 1;
+		poly x = randVec<ModInt>(n), p = randVec<ModInt>(rand() % 200);
+		if (it % 3 == 0) for (auto& v : x) v = rand() % 5; // repeated points
+		SubproductTree T(x);
+		auto a = T.Eval(p), b = T.EvalT(p);
+		rep(i,0,n) {
+			ModInt v = horner(p, x[i]);
+			assert(a[i] == v && b[i] == v);
+		}
+		if (it % 3 == 0) continue;
+		poly q = randVec<ModInt>(rand() % n + 1);
+		auto y = T.EvalT(q), r = T.Interpolate(y);
+		q.resize(n, 0);
+		rep(i,0,n) assert(r[i] == q[i]);
+	}
+	int n = 2e5;
+	poly x(n), p = randVec<ModInt>(n), a, b, r;
+	rep(i,0,n) x[i] = (int)((i * 1000003LL + 17) % MOD);
+	SubproductTree *T;
+	{
+		timeit t("build, n = 2*10^5");
+		T = new SubproductTree(x);
+	}
+	{
+		timeit t("Eval, n = 2*10^5");
+		a = T->Eval(p);
+	}
+	{
+		timeit t("EvalT, n = 2*10^5");
+		b = T->EvalT(p);
+	}
+	{
+		timeit t("Interpolate, n = 2*10^5");
+		r = T->Interpolate(b);
+	}
+	rep(i,0,n) assert(a[i] == b[i]);
+	rep(i,0,n) assert(r[i] == p[i]);
+	cout<<"Tests passed!"<<endl;
+}
@@ -0,0 +1,79 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../utilities/modint.h"
+const int MOD = 1e9 + 7;
+using ModInt = MInt<MOD>;
+#include "../../content/numerical/PolyMulCRT.h"
+#include "../../content/numerical/FFT.h"
+
+vector<ModInt> naive(vector<ModInt> a, vector<ModInt> b) {
+	if (a.empty() || b.empty()) return {};
+	vector<ModInt> c(sz(a) + sz(b) - 1);
+	rep(i,0,sz(a)) rep(j,0,sz(b)) c[i + j] = c[i + j] + a[i] * b[j];
+	return c;
+}
+
+// Split-double approach: 15-bit halves, 2 forward + 2 inverse FFTs.
+vector<ModInt> splitFFT(const vector<ModInt>& a, const vector<ModInt>& b) {
+	typedef complex<double> C;
+	int m = sz(a) + sz(b) - 1, n = 1, cut = 1 << 15;
+	while (n < m) n *= 2;
+	vector<C> L(n), R(n), outl(n), outs(n);
+	rep(i,0,sz(a)) L[i] = C((int)a[i].Get() / cut, (int)a[i].Get() % cut);
+	rep(i,0,sz(b)) R[i] = C((int)b[i].Get() / cut, (int)b[i].Get() % cut);
+	DFT(L, 0), DFT(R, 0);
+	rep(i,0,n) {
+		int j = -i & (n - 1);
+		outl[j] = (L[i] + conj(L[j])) * R[i] / (2.0 * n);
+		outs[j] = (L[i] - conj(L[j])) * R[i] / (2.0 * n) / C(0, 1);
+	}
+	DFT(outl, 0), DFT(outs, 0);
+	vector<ModInt> res(m);
+	rep(i,0,m) {
+		ll av = ll(real(outl[i]) + .5), cv = ll(imag(outs[i]) + .5);
+		ll bv = ll(imag(outl[i]) + .5) + ll(real(outs[i]) + .5);
+		res[i] = ((av % MOD * cut + bv) % MOD * cut + cv) % MOD;
+	}
+	return res;
+}
+
+vector<ModInt> randVec(int n, bool big) {
+	vector<ModInt> a(n);
+	for (auto& x : a) x = big ? MOD - 1 - rand() % 3 : rand() % MOD;
+	return a;
+}
+
+int main() {
+	rep(it,0,3000) {
+		auto a = randVec(rand() % 60, it % 4 == 0);
+		auto b = randVec(rand() % 60, it % 4 == 0);
+		assert(MulCRT(a, b) == naive(a, b));
+	}
+	// shared forward transform
+	rep(it,0,50) {
+		auto a = randVec(rand() % 200 + 1, 0);
+		int n = 512; auto fa = Forward(a, n);
+		rep(jt,0,5) {
+			auto b = randVec(rand() % 300 + 1, 0);
+			assert(MulCRT(fa, Forward(b, n), sz(a) + sz(b) - 1) == naive(a, b));
+		}
+	}
+
+	rep(lg,10,21) {
+		int n = 1 << (lg - 1), its = max(1, (1 << 18) / n);
+		auto a = randVec(n, 0), b = randVec(n, 0);
+		vector<ModInt> c, d;
+		ll t0 = tick();
+		rep(it,0,its) c = MulCRT(a, b);
+		ll t1 = tick();
+		rep(it,0,its) d = splitFFT(a, b);
+		ll t2 = tick();
+		int bad = 0;
+		rep(i,0,sz(c)) bad += !(c[i] == d[i]);
+		cout << "n = 2^" << lg << ": MulCRT " << (t1 - t0) / its / 1000
+			<< "us, split FFT " << (t2 - t1) / its / 1000 << "us ("
+			<< bad << " wrong)" << endl;
+	}
+	cout<<"Tests passed!"<<endl;
+}
@@ -0,0 +1,98 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../../content/numerical/PolyRoots.h"
+#include "../../content/numerical/PolyRootsAberth.h"
+
+vector<C> fromRoots(const vector<C>& r) {
+	vector<C> p{1};
+	for (C x : r) {
+		p.push_back(0);
+		for (int i = sz(p) - 1; i > 0; --i) p[i] = p[i - 1] - x * p[i];
+		p[0] *= -x;
+	}
+	return p;
+}
+
+// Max distance in a greedy matching of the two root sets
+double match(vector<C> a, vector<C> b) {
+	double ret = 0;
+	for (C x : a) {
+		int k = 0;
+		rep(i,0,sz(b)) if (abs(b[i] - x) < abs(b[k] - x)) k = i;
+		ret = max(ret, abs(b[k] - x)); b.erase(b.begin() + k);
+	}
+	return ret;
+}
+
+// |p(z)| relative to sum |p_i| |z|^i, in logs to avoid overflow
+double residual(const vector<C>& p, C z) {
+	int n = sz(p) - 1;
+	if (abs(z) <= 1) {
+		C v = 0; double s = 0;
+		for (int i = n; i >= 0; --i) v = v * z + p[i], s = s * abs(z) + abs(p[i]);
+		return abs(v) / s;
+	}
+	C y = 1. / z, v = 0; double s = 0;
+	rep(i,0,n+1) v = v * y + p[i], s = s * abs(y) + abs(p[i]);
+	return abs(v) / s;
+}
+
+int main() {
+	mt19937 rng(2);
+	uniform_real_distribution<double> U(-1, 1);
+	int cnt = 0;
+	rep(it,0,3000) {
+		int n = rng() % 20 + 1;
+		vector<C> r(n);
+		for (auto& x : r) x = C(U(rng), U(rng)) * (rng() % 3 ? 1. : 5.);
+		bool fft = rng() % 2;
+		auto p = fromRoots(r);
+		auto z = FindRootsAberth(p, fft);
+		assert(sz(z) == n);
+		// Well separated roots are found accurately
+		double sep = 1e9;
+		rep(i,0,n) rep(j,0,i) sep = min(sep, abs(r[i] - r[j]));
+		if (sep > 0.05) assert(match(r, z) < 1e-7), ++cnt;
+		for (C x : z) assert(residual(p, x) < 1e-12);
+	}
+	// Multiple roots, zero roots, degenerate input
+	{
+		auto z = FindRootsAberth(fromRoots({1, 1, 1, C(0, 2), C(0, 2)}));
+		assert(match({1, 1, 1, C(0, 2), C(0, 2)}, z) < 1e-4);
+		z = FindRootsAberth({0, 0, 0, 3});
+		assert(sz(z) == 3 && match({0, 0, 0}, z) == 0);
+		z = FindRootsAberth({-6, 1, 1, 0, 0});
+		assert(sz(z) == 2 && match({2, -3}, z) < 1e-12);
+		assert(FindRootsAberth({5}).empty());
+	}
+	// Agrees with Durand-Kerner
+	rep(it,0,100) {
+		int n = rng() % 10 + 1;
+		vector<C> p(n + 1);
+		for (auto& x : p) x = C(U(rng), U(rng));
+		assert(match(FindRoots(p), FindRootsAberth(p)) < 1e-6);
+	}
+
+	// High degree: random coefficients, and roots of unity-like clusters
+	for (int n : {200, 2000}) for (bool fft : {false, true}) {
+		vector<C> p(n + 1);
+		for (auto& x : p) x = C(U(rng), U(rng));
+		vector<C> z;
+		{
+			timeit t("Aberth, degree " + to_string(n) + (fft ? ", fft" : ""));
+			z = FindRootsAberth(p, fft);
+		}
+		double worst = 0;
+		for (C x : z) worst = max(worst, residual(p, x));
+		assert(worst < 1e-12);
+	}
+	{
+		vector<C> p(61);
+		for (auto& x : p) x = C(U(rng), U(rng));
+		{ timeit t("Durand-Kerner, degree 60"); FindRoots(p); }
+		{ timeit t("Aberth, degree 60"); FindRootsAberth(p); }
+	}
+	cerr << cnt << " separated cases" << endl;
+	cout<<"Tests passed!"<<endl;
+}
@@ -0,0 +1,77 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../utilities/modint.h"
+const int MOD = 998244353;
+using ModInt = MInt<MOD>;
+#include "../../content/numerical/PolySeries.h"
+
+typedef vector<ModInt> poly;
+
+poly naiveMul(poly a, poly b, int n) {
+	poly c(n, 0);
+	rep(i,0,sz(a)) rep(j,0,sz(b)) if (i + j < n) c[i + j] = c[i + j] + a[i] * b[j];
+	return c;
+}
+poly naiveExp(poly h, int n) {
+	h.resize(n, 0);
+	poly f(n, 0);
+	if (n) f[0] = 1;
+	rep(i,1,n) {
+		ModInt s = 0;
+		rep(k,1,i+1) s = s + h[k] * k * f[i - k];
+		f[i] = s / i;
+	}
+	return f;
+}
+int main() {
+	rep(it,0,300) {
+		int n = rand() % 70 + 1;
+		poly a = randVec<ModInt>(rand() % 80 + 1);
+		if (a[0] == 0) a[0] = 1;
+		assert(naiveMul(a, Inv(a, n), n) == [&]{ poly e(n, 0); e[0] = 1; return e; }());
+
+		poly h = randVec<ModInt>(rand() % 80 + 1); h[0] = 0;
+		poly e = Exp(h, n);
+		assert(e == naiveExp(h, n));
+		auto l = Log(e, n);
+		poly ht = h; ht.resize(n, 0);
+		assert(l == ht);
+
+		poly s = randVec<ModInt>(rand() % 80 + 1);
+		if (s[0] == 0) s[0] = 1;
+		poly sq = naiveMul(s, s, n);
+		poly r = Sqrt(sq, n, s[0]);
+		assert(naiveMul(r, r, n) == sq);
+
+		poly p = randVec<ModInt>(rand() % 10 + 1);
+		rep(i,0,rand() % 4) p[i] = 0;
+		int k = rand() % 8;
+		poly pk(n, 0); pk[0] = 1;
+		rep(i,0,k) pk = naiveMul(pk, p, n);
+		assert(Pow(p, k, n) == pk);
+
+		poly ca = randVec<ModInt>(rand() % 30), cb = randVec<ModInt>(rand() % 30);
+		poly comp(n, 0);
+		for (int i = sz(ca) - 1; i >= 0; --i) {
+			comp = naiveMul(comp, cb, n);
+			comp[0] = comp[0] + ca[i];
+		}
+		assert(Compose(ca, cb, n) == comp);
+	}
+	// empty results
+	poly one{1};
+	assert(Log(one, 0).empty() && Exp(poly{0}, 0).empty());
+	assert(Pow(one, 0, 0).empty() && Sqrt(one, 0).empty());
+	// pow with a huge exponent and leading zeros
+	poly p{0, 0, 1, 1};
+	assert(Pow(p, (ll)1e18, 50) == poly(50, 0));
+	{
+		timeit t("Exp, n = 10^6");
+		int n = 1e6;
+		poly h = randVec<ModInt>(n); h[0] = 0;
+		auto e = Exp(h, n);
+		assert(e[0] == 1 && e[1] == h[1]);
+	}
+	cout<<"Tests passed!"<<endl;
+}
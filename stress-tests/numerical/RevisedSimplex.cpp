@@ -0,0 +1,95 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+namespace old {
+#include "../../content/numerical/Simplex.h"
+}
+#undef FOR
+#undef MT
+#include "../../content/numerical/RevisedSimplex.h"
+
+const double inf = 1 / .0;
+
+// max c^T x, A x <= b, l <= x <= u (l finite) via the dense tableau
+double dense(vector<vector<double>> A, vector<double> b, vector<double> c,
+		vector<double> l, vector<double> u) {
+	int m = sz(A), n = sz(c);
+	double off = 0;
+	rep(j,0,n) {
+		off += c[j] * l[j];
+		rep(i,0,m) b[i] -= A[i][j] * l[j];
+		if (u[j] < inf) {
+			vector<double> r(n, 0); r[j] = 1;
+			A.push_back(r); b.push_back(u[j] - l[j]);
+		}
+	}
+	vector<double> x;
+	double v = old::Simplex(A, b, c, x);
+	return abs(v) == inf ? v : v + off;
+}
+
+int main() {
+	int cnt[3] = {};
+	rep(it,0,20000) {
+		int m = rand() % 8 + 1, n = rand() % 8 + 1;
+		vector<vector<double>> A(m, vector<double>(n));
+		vector<double> b(m), c(n), l(n), u(n);
+		RevisedSimplex lp(m, n);
+		rep(i,0,m) rep(j,0,n) if (rand() % 3) {
+			A[i][j] = rand() % 11 - 5;
+			if (A[i][j]) lp.Add(i, j, A[i][j]);
+		}
+		rep(i,0,m) b[i] = rand() % 21 - 5, lp.Row(i, -inf, b[i]);
+		rep(j,0,n) {
+			c[j] = lp.c[j] = rand() % 11 - 5;
+			l[j] = rand() % 3 ? 0 : rand() % 7 - 3;
+			u[j] = rand() % 2 ? inf : l[j] + rand() % 6;
+			lp.Bound(j, l[j], u[j]);
+		}
+		double want = dense(A, b, c, l, u), got = lp.Solve();
+		cnt[want == -inf ? 0 : want == inf ? 2 : 1]++;
+		if (abs(want) == inf) assert(got == want);
+		else {
+			assert(abs(got - want) < 1e-6);
+			double val = 0;
+			rep(j,0,n) {
+				assert(lp.x[j] >= l[j] - 1e-6 && lp.x[j] <= u[j] + 1e-6);
+				val += c[j] * lp.x[j];
+			}
+			rep(i,0,m) {
+				double s = 0;
+				rep(j,0,n) s += A[i][j] * lp.x[j];
+				assert(s <= b[i] + 1e-6);
+			}
+			assert(abs(val - want) < 1e-6);
+		}
+		// Warm start after changing costs and bounds
+		rep(j,0,n) if (rand() % 2) c[j] = lp.c[j] = rand() % 11 - 5;
+		rep(j,0,n) if (rand() % 4 == 0) {
+			u[j] = l[j] + rand() % 6;
+			lp.Bound(j, l[j], u[j]);
+		}
+		want = dense(A, b, c, l, u), got = lp.Solve();
+		if (abs(want) == inf) assert(got == want);
+		else assert(abs(got - want) < 1e-6);
+	}
+	cerr << "infeasible/optimal/unbounded: " << cnt[0] << " " << cnt[1] << " " << cnt[2] << endl;
+
+	// Sparse 5000 x 5000, 5 non-zeros per column
+	int m = 5000, n = 5000;
+	RevisedSimplex lp(m, n);
+	mt19937 rng(1);
+	rep(j,0,n) rep(k,0,5) lp.Add(rng() % m, j, rng() % 100 + 1);
+	rep(i,0,m) lp.Row(i, -inf, rng() % 1000 + 1);
+	rep(j,0,n) lp.c[j] = rng() % 100 + 1, lp.Bound(j, 0, rng() % 50 + 1);
+	double v;
+	{ timeit t("cold 5000x5000"); v = lp.Solve(); }
+	rep(j,0,n) if (rng() % 100 == 0) lp.c[j] = rng() % 100 + 1;
+	{ timeit t("warm, 1% costs changed"); v = lp.Solve(); }
+	RevisedSimplex lp2(m, n);
+	lp2.col = lp.col; lp2.lo = lp.lo; lp2.hi = lp.hi; lp2.c = lp.c;
+	double v2;
+	{ timeit t("cold again"); v2 = lp2.Solve(); }
+	assert(abs(v - v2) < 1e-6 * abs(v));
+	cout<<"Tests passed!"<<endl;
+}
@@ -0,0 +1,81 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../../content/numerical/RowEchelon.h"
+
+namespace old {
+pair<vector<int>, int> RowEchelon(mat& A) {
+	int n = sz(A), m = sz(A[0]), sgn = 1;
+	vector<int> piv;
+	for (int i = 0, rnk = 0; i < m && rnk < n; ++i) {
+		rep(j,rnk+1,n) if (abs(A[j][i]) > abs(A[rnk][i]))
+			swap(A[j], A[rnk]), sgn = -sgn;
+		if (abs(A[rnk][i]) < EPS) continue;
+		rep(j,0,n) {
+			ld coef = A[j][i] / A[rnk][i];
+			if (j == rnk || abs(coef) < EPS) continue;
+			rep(k,0,m) A[j][k] -= coef * A[rnk][k];
+		}
+		piv.push_back(i); ++rnk;
+	}
+	return {piv, sgn};
+}
+}
+
+mat randMat(int n, int m, int rank) {
+	mat A(n, vector<ld>(m)), B(rank, vector<ld>(m));
+	for (auto& r : B) for (auto& x : r) x = rand() % 2001 / 1000.0 - 1;
+	int zc = rand() % 3 ? -1 : rand() % m; // an all-zero column
+	rep(i,0,n) {
+		if (i < rank) A[i] = B[i];
+		else rep(t,0,rank) rep(j,0,m) A[i][j] += (rand() % 5 - 2) * B[t][j];
+		if (zc >= 0) A[i][zc] = 0;
+	}
+	random_shuffle(all(A));
+	return A;
+}
+
+// Pivot rows, scaled to have 1 on the pivot, in order
+mat normalized(mat A, vector<int> piv) {
+	mat R;
+	rep(i,0,sz(piv)) {
+		R.push_back(A[i]);
+		for (auto& x : R.back()) x /= A[i][piv[i]];
+	}
+	return R;
+}
+
+int main() {
+	rep(it,0,1000) {
+		int n = rand() % 80 + 1, m = rand() % 80 + 1;
+		int rank = rand() % 2 ? min(n, m) : rand() % (min(n, m) + 1);
+		mat A = randMat(n, m, rank), B = A;
+		auto [p1, s1] = old::RowEchelon(A);
+		auto [p2, s2] = RowEchelon(B);
+		assert(p1 == p2);
+		mat X = normalized(A, p1), Y = normalized(B, p2);
+		rep(i,0,sz(X)) rep(j,0,m) assert(abs(X[i][j] - Y[i][j]) < 1e-6);
+		rep(i,sz(p2),n) rep(j,0,m) assert(abs(B[i][j]) < 1e-6);
+		rep(i,0,sz(p2)) rep(k,0,sz(p2)) if (i != k) assert(B[k][p2[i]] == 0);
+		if (n == m && sz(p1) == n) { // determinants
+			ld d1 = s1, d2 = s2;
+			rep(i,0,n) d1 *= A[i][i], d2 *= B[i][i];
+			assert(abs(d1 - d2) <= 1e-6 * abs(d1));
+		}
+	}
+
+	for (int n : {500, 1000, 2000, 4000}) {
+		Matrix M(n, n); mat A(n, vector<ld>(n));
+		rep(i,0,n) rep(j,0,n) M[i][j] = A[i][j] = rand() % 2001 / 1000.0 - 1;
+		{
+			timeit t("new n=" + to_string(n));
+			assert(sz(RowEchelon(M).first) == n);
+		}
+		if (n <= 1000) {
+			timeit t("old n=" + to_string(n));
+			old::RowEchelon(A);
+			rep(i,0,n) rep(j,0,n) assert(abs(A[i][j] - M[i][j]) < 1e-6 * max(1.0, abs(A[i][j])));
+		}
+	}
+	cout<<"Tests passed!"<<endl;
+}
@@ -0,0 +1,80 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../../content/numerical/RowEchelonBinary.h"
+
+// Plain Gauss-Jordan on vectors of bits
+pair<vi, int> naive(vector<vi>& A) {
+	int n = sz(A), m = sz(A[0]), sgn = 1, rnk = 0;
+	vi piv;
+	rep(i,0,m) {
+		if (rnk == n) break;
+		int p = rnk;
+		while (p < n && !A[p][i]) ++p;
+		if (p == n) continue;
+		if (p != rnk) swap(A[p], A[rnk]), sgn = -sgn;
+		rep(j,0,n) if (j != rnk && A[j][i]) rep(k,0,m) A[j][k] ^= A[rnk][k];
+		piv.push_back(i); ++rnk;
+	}
+	return {piv, sgn};
+}
+
+int main() {
+	rep(it,0,3000) {
+		int n = rand() % 100 + 1, m = rand() % 150 + 1;
+		int dens = rand() % 10 + 1, rank = rand() % (n + 1);
+		vector<vi> V(n, vi(m));
+		rep(i,0,n) rep(j,0,m) V[i][j] = rand() % dens == 0;
+		if (rand() % 2) rep(i,rank,n) { // dependent rows
+			fill(all(V[i]), 0);
+			rep(t,0,rank) if (rand() % 2) rep(j,0,m) V[i][j] ^= V[t][j];
+		}
+		BitMatrix A(n, m);
+		rep(i,0,n) rep(j,0,m) if (V[i][j]) A.flip(i, j);
+		auto [p1, s1] = naive(V);
+		auto [p2, s2] = RowEchelon(A);
+		assert(p1 == p2);
+		// Reduced echelon form is unique
+		rep(i,0,n) rep(j,0,m) assert(A.get(i, j) == V[i][j]);
+		if (n == m && sz(p1) == n) assert(s1 == s2);
+	}
+	rep(it,0,1000) { // Solve
+		int n = rand() % 50 + 1, m = rand() % 50 + 1;
+		vector<vi> M(n, vi(m));
+		vi x(m), b(n);
+		for (auto& r : M) for (auto& v : r) v = rand() % 2;
+		for (auto& v : x) v = rand() % 2;
+		rep(i,0,n) rep(j,0,m) b[i] ^= M[i][j] & x[j];
+		bool bad = rand() % 4 == 0;
+		if (bad) b[rand() % n] ^= 1;
+		BitMatrix A(n, m + 1);
+		rep(i,0,n) {
+			rep(j,0,m) if (M[i][j]) A.flip(i, j);
+			if (b[i]) A.flip(i, m);
+		}
+		vi sol = SolveLinear(A);
+		if (!bad) assert(sz(sol) == m);
+		if (sz(sol)) rep(i,0,n) {
+			int v = 0;
+			rep(j,0,m) v ^= M[i][j] & sol[j];
+			assert(v == b[i]);
+		}
+	}
+	rep(m,1,70) { // zero matrix: x = 0 iff b = 0
+		BitMatrix Z(3, m + 1);
+		assert(SolveLinear(Z) == vi(m, 0));
+		Z.flip(1, m);
+		assert(SolveLinear(Z).empty());
+	}
+
+	int n = 10000;
+	BitMatrix A(n, n);
+	for (auto& x : A.a) x = (u64)rand() << 33 ^ (u64)rand() << 11 ^ rand();
+	rep(i,0,n) A[i][A.w - 1] &= (1ULL << (n % 64)) - 1;
+	{
+		timeit t("10^4 x 10^4");
+		int r = sz(RowEchelon(A).first);
+		assert(r >= n - 20);
+	}
+	cout<<"Tests passed!"<<endl;
+}
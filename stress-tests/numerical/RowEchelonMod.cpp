@@ -0,0 +1,60 @@
+#include "../utilities/template.h"
+
+#include "../../content/numerical/RowEchelonMod.h"
+
+ModInt detLeibniz(matm A) {
+	int n = sz(A);
+	vi p(n); iota(all(p), 0);
+	ModInt ret = 0;
+	do {
+		ModInt prod = 1; int inv = 0;
+		rep(i,0,n) rep(j,0,i) inv += p[j] > p[i];
+		rep(i,0,n) prod = prod * A[i][p[i]];
+		ret = inv % 2 ? ret - prod : ret + prod;
+	} while (next_permutation(all(p)));
+	return ret;
+}
+
+int main() {
+	rep(it,0,3000) {
+		int n = rand() % 7 + 1, m = rand() % 7 + 1;
+		matm A(n, vector<ModInt>(m));
+		int dens = rand() % 4 + 1;
+		for (auto& r : A) for (auto& x : r) x = rand() % dens ? 0 : rand() % MOD;
+		matm B = A;
+		auto [piv, sgn] = RowEchelon(B);
+		rep(i,0,sz(piv)) {
+			rep(j,0,piv[i]) assert(B[i][j] == 0);
+			assert(!(B[i][piv[i]] == 0));
+			rep(k,0,n) if (k != i) assert(B[k][piv[i]] == 0);
+		}
+		rep(i,sz(piv),n) rep(j,0,m) assert(B[i][j] == 0);
+		if (n == m) {
+			ModInt d = sgn;
+			rep(i,0,n) d = d * B[i][i];
+			assert(d == detLeibniz(A));
+		}
+		// Solve: consistent systems must get a solution
+		vector<ModInt> x(m), b(n, 0);
+		for (auto& v : x) v = rand() % MOD;
+		rep(i,0,n) rep(j,0,m) b[i] = b[i] + A[i][j] * x[j];
+		bool bad = rand() % 4 == 0;
+		if (bad) b[rand() % n] = rand() % MOD;
+		matm C = A;
+		rep(i,0,n) C[i].push_back(b[i]);
+		auto sol = SolveLinear(C);
+		if (!bad) assert(sz(sol) == m);
+		if (sz(sol)) rep(i,0,n) {
+			ModInt v = 0;
+			rep(j,0,m) v = v + A[i][j] * sol[j];
+			assert(v == b[i]);
+		}
+	}
+	rep(m,1,6) { // zero matrix: x = 0 iff b = 0
+		matm Z(3, vector<ModInt>(m + 1, 0));
+		assert(SolveLinear(Z) == vector<ModInt>(m, 0));
+		Z[1][m] = 1;
+		assert(SolveLinear(Z).empty());
+	}
+	cout<<"Tests passed!"<<endl;
+}
@@ -0,0 +1,45 @@
+#include "../utilities/template.h"
+#include "../utilities/bench.h"
+
+#include "../../content/numerical/SubsetConv.h"
+
+namespace old {
+Poly SubsetConv(Poly a, Poly b) {
+	int n = sz(a), lg = 31 - __builtin_clz(n);
+	vector<Poly> p(lg + 1, Poly(n, 0)), q(p);
+	rep(i,0,n) {
+		int lev = __builtin_popcount(i);
+		p[lev][i] = a[i]; q[lev][i] = b[i];
+	}
+	rep(i,0,lg+1) FST<OR>(p[i], 0), FST<OR>(q[i], 0);
+	rep(i,0,lg+1) {
+		fill(all(b), 0);
+		rep(j,0,i+1) rep(k,0,n) b[k] = b[k] + p[j][k] * q[i - j][k];
+		FST<OR>(b, 1);
+		rep(j,0,n) if (__builtin_popcount(j) == i) a[j] = b[j];
+	}
+	return a;
+}
+}
+
+int main() {
+	rep(lg,0,11) rep(it,0,3) {
+		int n = 1 << lg;
+		vi a(n), b(n), want(n);
+		for (auto& x : a) x = rand() % 11 - 5;
+		for (auto& x : b) x = rand() % 11 - 5;
+		rep(i,0,n) for (int j = (n - 1) & ~i; ; j = (j - 1) & ~i) {
+			want[i | j] += a[i] * b[j];
+			if (!j) break;
+		}
+		assert(SubsetConv(a, b) == want);
+	}
+
+	vi a(1 << 20), b(1 << 20), c, d;
+	for (auto& x : a) x = rand();
+	for (auto& x : b) x = rand();
+	{ timeit t("old 2^20"); c = old::SubsetConv(a, b); }
+	{ timeit t("new 2^20"); d = SubsetConv(a, b); }
+	assert(c == d);
+	cout<<"Tests passed!"<<endl;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+// MInt, MInt64 and DynMInt from ModInt.h, without its MOD and ModInt.
+// Set `const int MOD = ...; using ModInt = MInt<MOD>;` before including
+// headers that use ModInt. Compare values with == or Get(), not .x.
+namespace ignore {
+#include "../../content/number-theory/ModInt.h"
+}
+using ignore::MInt;
+using ignore::MInt64;
+using ignore::DynMInt;
+
+template<class T> vector<T> randVec(int n) {
+	vector<T> a(n);
+	for (auto& x : a) x = rand() % T::mod();
+	return a;
+}